@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Alert {
+
+        using RuleId = uint32_t;
+
+        /// @brief 규칙 종류
+        enum class RuleType {
+            THRESHOLD,       // 값이 임계값을 넘으면 발생
+            RATE_OF_CHANGE,  // 초당 변화량이 임계값을 넘으면 발생
+            DURATION         // 값이 임계값을 넘은 상태가 duration_ns 이상 지속되면 발생
+        };
+
+        /// @brief 비교 방향
+        enum class Comparison {
+            ABOVE,
+            BELOW
+        };
+
+        /// @brief 알림 심각도
+        enum class AlertSeverity {
+            INFO,
+            WARNING,
+            CRITICAL
+        };
+
+        /// @brief 알림 상태 전이
+        enum class AlertTransition {
+            RAISED,
+            CLEARED
+        };
+
+        /// @brief 알림 규칙 정의
+        struct AlertRule {
+            std::string name;
+            Sensor::ChannelId channel = 0;
+            RuleType type = RuleType::THRESHOLD;
+            Comparison comparison = Comparison::ABOVE;
+            float threshold = 0.0f;          // RATE_OF_CHANGE는 단위/초
+            float hysteresis = 0.0f;         // 해제하려면 threshold에서 이만큼 더 벗어나야 함
+            Time::Timestamp duration_ns = 0; // DURATION 규칙의 최소 지속 시간
+            uint32_t debounce_samples = 1;   // 연속으로 조건을 만족해야 하는 샘플 수
+            AlertSeverity severity = AlertSeverity::WARNING;
+        };
+
+        /// @brief 알림 이벤트 (규칙 상태가 바뀔 때마다 하나씩 생성)
+        struct AlertEvent {
+            RuleId rule_id = 0;
+            uint32_t device_id = 0;
+            Sensor::ChannelId channel = 0;
+            AlertTransition transition = AlertTransition::RAISED;
+            AlertSeverity severity = AlertSeverity::WARNING;
+            float value = 0.0f;              // 전이를 일으킨 측정값 (변화율 규칙은 초당 변화량)
+            Time::Timestamp timestamp_ns = 0;
+        };
+
+        /// @brief 수집 시점 알림 규칙 엔진
+        /// @details 규칙은 채널별로 색인되어 있어 배치의 각 채널 열을 한 번씩 순회하며
+        ///          해당 채널에 걸린 규칙만 평가한다. 상태(히스테리시스, 디바운스)는
+        ///          디바이스 x 규칙 단위로 유지된다.
+        class AlertEngine {
+        public:
+            AlertEngine();
+            ~AlertEngine();
+
+            AlertEngine(const AlertEngine&) = delete;
+            AlertEngine& operator=(const AlertEngine&) = delete;
+            AlertEngine(AlertEngine&&) noexcept;
+            AlertEngine& operator=(AlertEngine&&) noexcept;
+
+            /// @brief 규칙 추가
+            /// @return 추가된 규칙 ID
+            RuleId addRule(const AlertRule& rule);
+
+            /// @brief 규칙 제거
+            /// @return 제거 성공 여부
+            bool removeRule(RuleId id);
+
+            /// @brief 모든 규칙과 상태 제거
+            void clearRules();
+
+            /// @brief 활성 규칙 개수
+            size_t getRuleCount() const;
+
+            /// @brief 규칙 정의 조회
+            /// @return 규칙 존재 여부
+            bool getRule(RuleId id, AlertRule& out) const;
+
+            /// @brief 배치의 모든 샘플에 대해 규칙 평가
+            /// @param batch 수집된 샘플 배치
+            /// @param out 발생한 알림 이벤트가 뒤에 추가됨
+            /// @return 발생한 이벤트 개수
+            size_t process(const Sensor::SensorBatch& batch, std::vector<AlertEvent>& out);
+
+            /// @brief 디바이스의 규칙이 현재 발생 상태인지 확인
+            bool isActive(uint32_t device_id, RuleId id) const;
+
+            /// @brief 현재 발생 중인 알림 목록 (발생 시점의 이벤트)
+            std::vector<AlertEvent> getActiveAlerts() const;
+
+            /// @brief 규칙은 유지하고 디바이스별 평가 상태만 초기화
+            void resetState();
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Alert
+} // namespace DachshundEngine
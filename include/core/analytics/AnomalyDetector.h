@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 이상치 이벤트
+        struct AnomalyEvent {
+            uint32_t device_id = 0;
+            Sensor::ChannelId channel = 0;
+            float value = 0.0f;
+            float score = 0.0f;          // max(|ewma_z|, |robust_z|)
+            float ewma_z = 0.0f;         // (x - EWMA 평균) / EWMA 표준편차
+            float robust_z = 0.0f;       // 0.6745 * (x - 중앙값) / MAD (MAD가 0이면 0, EWMA z만 사용)
+            Time::Timestamp timestamp_ns = 0;
+        };
+
+        /// @brief 이상치 탐지 설정
+        struct AnomalyConfig {
+            std::vector<Sensor::ChannelId> channels;   // 비어 있으면 배치의 모든 채널
+            float alpha = 0.05f;                       // EWMA 가중치 (유효 창 ~ 2/alpha 샘플)
+            float threshold = 4.0f;                    // score가 이 값을 넘으면 이상치
+            uint32_t warmup_samples = 32;              // 통계가 안정될 때까지 판정하지 않음
+            uint32_t robust_window = 64;               // 중앙값/MAD 계산 창
+            uint32_t robust_refresh = 16;              // 중앙값/MAD를 다시 계산하는 주기 (샘플)
+            uint32_t cooldown_samples = 16;            // 같은 스트림에서 연속 이벤트 억제
+            // 표준편차/MAD 하한: max(min_spread, relative_min_spread * |기준값|).
+            // 평평하거나 양자화된 채널에서 1 LSB 변화가 거대한 z가 되지 않게 한다
+            float min_spread = 0.0f;                   // 절대 하한 (채널 분해능, 예: 습도 0.1)
+            float relative_min_spread = 1e-3f;         // EWMA 평균/중앙값 크기에 대한 비율
+        };
+
+        /// @brief 스트리밍 이상치 탐지기 (디바이스 x 채널 스트림별)
+        /// @details 디바이스마다 채널 단위 SoA 상태 배열을 두고, 배치의 샘플 하나마다
+        ///          채널 축으로 EWMA 커널을 돌린다 (채널 간 의존성이 없어 벡터화 가능).
+        ///          이상치로 판정된 값은 평균/분산을 끌어가지 않도록 임계 범위로 잘라서 반영한다.
+        ///          중앙값/MAD는 최근 robust_window 샘플에서 robust_refresh 주기로 갱신한다.
+        class AnomalyDetector {
+        public:
+            explicit AnomalyDetector(const AnomalyConfig& config = AnomalyConfig());
+            ~AnomalyDetector();
+
+            AnomalyDetector(const AnomalyDetector&) = delete;
+            AnomalyDetector& operator=(const AnomalyDetector&) = delete;
+            AnomalyDetector(AnomalyDetector&&) noexcept;
+            AnomalyDetector& operator=(AnomalyDetector&&) noexcept;
+
+            /// @brief 배치 평가
+            /// @param out 탐지된 이상치 이벤트가 뒤에 추가됨
+            /// @return 탐지된 이벤트 개수
+            size_t process(const Sensor::SensorBatch& batch, std::vector<AnomalyEvent>& out);
+
+            /// @brief 추적 중인 스트림(디바이스 x 채널) 개수
+            size_t getStreamCount() const;
+
+            /// @brief 누적 탐지 개수
+            uint64_t getAnomalyCount() const;
+
+            /// @brief 모든 스트림 통계 초기화
+            void reset();
+
+            const AnomalyConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+#include "core/analytics/TimeAlignedJoin.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 상관 행렬의 변수 하나 (정렬 배치의 스트림 x 채널)
+        struct CorrelationInput {
+            size_t stream = 0;              // AlignedBatch의 스트림 인덱스 (SensorBatch 입력에서는 무시)
+            Sensor::ChannelId channel = 0;
+        };
+
+        /// @brief 최근 window 프레임에 대한 교차 채널 공분산/상관 행렬
+        /// @details 프레임(변수 V개) 하나가 들어올 때 창에서 빠지는 프레임과 함께
+        ///          합계와 곱의 합(상삼각)을 O(V^2)로 갱신한다. 곱의 합 갱신은 행 단위로
+        ///          연속 메모리를 도는 루프라 자동 벡터화된다. 상쇄 오차를 줄이기 위해 첫 프레임
+        ///          값을 기준점으로 빼서 누적하고, 주기적으로 창 전체에서 다시 계산한다.
+        ///          변수 중 하나라도 NaN인 프레임은 건너뛴다.
+        ///          내부 잠금이 있어 수집 스레드와 UI 스레드에서 함께 호출해도 된다.
+        class CorrelationMatrix {
+        public:
+            CorrelationMatrix(std::vector<CorrelationInput> inputs, size_t window = 256);
+            ~CorrelationMatrix();
+
+            CorrelationMatrix(const CorrelationMatrix&) = delete;
+            CorrelationMatrix& operator=(const CorrelationMatrix&) = delete;
+            CorrelationMatrix(CorrelationMatrix&&) noexcept;
+            CorrelationMatrix& operator=(CorrelationMatrix&&) noexcept;
+
+            /// @brief 프레임 하나 추가 (getVariableCount()개 값)
+            void push(const float* frame);
+
+            /// @brief 한 디바이스 배치의 샘플들을 프레임으로 추가 (입력의 channel만 사용)
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief 시간 정렬된 멀티 디바이스 프레임 추가 (디바이스 간 상관)
+            void process(const AlignedBatch& batch);
+
+            /// @brief 상관 행렬 (V x V, 행 우선). 분산이 0인 변수는 NaN
+            /// @return 프레임이 2개 이상이면 true
+            bool getCorrelation(std::vector<float>& out) const;
+
+            /// @brief 표본 공분산 행렬 (V x V, 행 우선)
+            bool getCovariance(std::vector<float>& out) const;
+
+            size_t getVariableCount() const;
+            size_t getFrameCount() const;      // 현재 창에 든 프레임 수
+            const std::vector<CorrelationInput>& getInputs() const;
+            void reset();
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 불리언 채널 구간 통계
+        struct EdgeStats {
+            double duty_cycle = 0.0;          // 관측 시간 중 true였던 비율
+            uint32_t rising_edges = 0;
+            uint32_t falling_edges = 0;
+            Time::Timestamp last_change = 0;  // 구간 끝 이전 마지막 전이 시각 (없으면 0)
+            bool state = false;               // 구간 끝 시점의 상태
+            Time::Timestamp observed_ns = 0;  // 실제로 관측된 구간 길이
+        };
+
+        /// @brief 엣지 로그 설정
+        struct EdgeLogConfig {
+            std::vector<Sensor::ChannelId> channels = { Sensor::toChannelId(Sensor::SensorChannel::MOTION) };
+            float threshold = 0.5f;           // 이 값 이상이면 true
+            size_t max_edges = 1 << 16;       // 스트림당 보관할 전이 수 (넘으면 오래된 것부터 버림)
+        };
+
+        /// @brief 불리언 채널(모션 등)의 전이 시각 로그
+        /// @details 샘플마다 값을 저장하지 않고 상태가 바뀐 시각만 저장한다 (런 길이 인코딩).
+        ///          스트림은 시작 시각/시작 상태와 전이 시각 배열로 표현되며, i번째 전이 후
+        ///          상태는 시작 상태를 (i + 1)번 뒤집은 값이다. 구간 질의는 이분 탐색 후
+        ///          구간 안의 전이만 훑는다. 50Hz 모션 센서라도 움직임이 없으면 저장량이 늘지 않는다.
+        ///          내부 잠금이 있어 수집 스레드와 UI 스레드에서 함께 호출해도 된다.
+        class EdgeLog {
+        public:
+            explicit EdgeLog(const EdgeLogConfig& config = EdgeLogConfig());
+            ~EdgeLog();
+
+            EdgeLog(const EdgeLog&) = delete;
+            EdgeLog& operator=(const EdgeLog&) = delete;
+            EdgeLog(EdgeLog&&) noexcept;
+            EdgeLog& operator=(EdgeLog&&) noexcept;
+
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief [from, to) 구간 통계 (관측 범위 밖은 제외)
+            /// @return 구간과 겹치는 관측이 있으면 true
+            bool query(uint32_t device_id, Sensor::ChannelId channel, Time::Timestamp from, Time::Timestamp to,
+                       EdgeStats& out) const;
+
+            /// @brief 시각 t의 상태
+            bool stateAt(uint32_t device_id, Sensor::ChannelId channel, Time::Timestamp t, bool& state) const;
+
+            /// @brief 타임라인 그리기용: [from, to) 안의 전이 시각과 from 시점 상태
+            /// @return 전이 개수
+            size_t getEdges(uint32_t device_id, Sensor::ChannelId channel, Time::Timestamp from, Time::Timestamp to,
+                            std::vector<Time::Timestamp>& edges, bool& initial_state) const;
+
+            /// @brief 모든 스트림이 쓰는 전이 저장 바이트 수
+            size_t getStorageBytes() const;
+
+            const EdgeLogConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 채널 하나의 플릿 요약
+        struct ChannelSummary {
+            Sensor::ChannelId channel = 0;
+            size_t device_count = 0;
+            float min = 0.0f;
+            float mean = 0.0f;
+            float max = 0.0f;
+            float p50 = 0.0f;            // 분위수는 recompute에서만 채워짐 (증분 요약은 NaN)
+            float p90 = 0.0f;
+            float p99 = 0.0f;
+            uint32_t min_device = 0;
+            uint32_t max_device = 0;
+        };
+
+        /// @brief 순위 항목
+        struct DeviceRank {
+            uint32_t device_id = 0;
+            float value = 0.0f;
+        };
+
+        /// @brief 플릿 집계 설정
+        struct FleetConfig {
+            std::vector<Sensor::ChannelId> channels;   // 비어 있으면 기본 채널 전체
+            float smoothing = 0.2f;                     // 디바이스 값 EWMA 가중치 (1이면 최신값)
+            Time::Timestamp stale_after = 0;            // 이 시간 동안 소식이 없는 디바이스는 제외 (0이면 제외 안 함)
+            size_t parallel_threshold = 512;            // 이 디바이스 수 이상이면 recompute를 여러 스레드로 분할
+            unsigned max_threads = 0;                   // 0이면 hardware_concurrency
+        };
+
+        /// @brief 멀티 디바이스 플릿 집계
+        /// @details 디바이스마다 채널 값(EWMA)을 채널 x 디바이스 SoA 배열에 둔다.
+        ///          수집 시에는 채널별 정렬 집합과 합계만 O(log N)으로 갱신하므로
+        ///          min/mean/max와 top-K는 바로 조회된다. 분위수까지 포함한 전체 재계산은
+        ///          디바이스 구간을 스레드별로 나눠 부분 결과를 병합하는 병렬 리덕션이다.
+        ///          내부 잠금이 있어 수집 스레드와 UI 스레드에서 함께 호출해도 된다.
+        class FleetAggregator {
+        public:
+            explicit FleetAggregator(const FleetConfig& config = FleetConfig());
+            ~FleetAggregator();
+
+            FleetAggregator(const FleetAggregator&) = delete;
+            FleetAggregator& operator=(const FleetAggregator&) = delete;
+            FleetAggregator(FleetAggregator&&) noexcept;
+            FleetAggregator& operator=(FleetAggregator&&) noexcept;
+
+            /// @brief 수집된 배치 반영 (증분 갱신)
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief 증분 요약 (min/mean/max, 분위수는 NaN)
+            /// @return 채널에 값이 있는 디바이스가 있으면 true
+            bool getSummary(Sensor::ChannelId channel, ChannelSummary& out) const;
+
+            /// @brief 값이 큰(또는 작은) 순서로 상위 K개 디바이스
+            void getTopK(Sensor::ChannelId channel, size_t k, std::vector<DeviceRank>& out, bool highest = true) const;
+
+            /// @brief 모든 채널의 전체 재계산 (분위수 포함, 병렬 리덕션)
+            /// @param now stale_after 판정 기준 시각
+            /// @return 요약한 채널 수
+            size_t recompute(std::vector<ChannelSummary>& out, Time::Timestamp now) const;
+
+            /// @brief stale_after를 넘긴 디바이스를 증분 집합에서 제거
+            /// @return 제거된 디바이스 수
+            size_t expireStale(Time::Timestamp now);
+
+            size_t getDeviceCount() const;
+            const FleetConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
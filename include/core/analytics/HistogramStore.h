@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 히스토그램 빈 간격
+        enum class BinScale {
+            LINEAR,   // [min, max]를 같은 폭으로 나눔
+            LOG       // log(min) ~ log(max)를 같은 폭으로 나눔 (min > 0)
+        };
+
+        /// @brief 채널 하나의 히스토그램 형태
+        struct HistogramSpec {
+            Sensor::ChannelId channel = 0;
+            float min = 0.0f;
+            float max = 100.0f;
+            uint16_t bins = 32;
+            BinScale scale = BinScale::LINEAR;
+        };
+
+        /// @brief 히스토그램 저장소 설정
+        struct HistogramConfig {
+            std::vector<HistogramSpec> channels;
+            Time::Timestamp bucket_ns = 10 * Time::kNanosPerSecond;
+            size_t retention_buckets = 120;
+        };
+
+        /// @brief 채널 x 시간 구간별 증분 히스토그램 (모든 디바이스 합산)
+        /// @details 구간은 retention_buckets 칸짜리 링에 구간 번호 % 칸 수 위치로 저장되므로
+        ///          샘플 하나의 갱신은 빈 번호 계산과 카운터 증가뿐인 O(1)이다.
+        ///          범위를 벗어난 값은 양 끝 빈에 넣고 따로 센다.
+        ///          내부 잠금이 있어 수집 스레드와 UI 스레드에서 함께 호출해도 된다.
+        class HistogramStore {
+        public:
+            explicit HistogramStore(const HistogramConfig& config);
+            ~HistogramStore();
+
+            HistogramStore(const HistogramStore&) = delete;
+            HistogramStore& operator=(const HistogramStore&) = delete;
+            HistogramStore(HistogramStore&&) noexcept;
+            HistogramStore& operator=(HistogramStore&&) noexcept;
+
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief 시간 x 값 히트맵 (ImPlot::PlotHeatmap 형식: 행 = 빈(위가 큰 값), 열 = 구간(오른쪽이 최신))
+            /// @param normalize true면 구간마다 합이 1이 되도록 정규화
+            /// @param first_bucket_start 첫 열의 구간 시작 시각
+            /// @return 데이터가 있으면 true
+            bool getHeatmap(Sensor::ChannelId channel, std::vector<float>& values, size_t& rows, size_t& cols,
+                            Time::Timestamp& first_bucket_start, bool normalize = true) const;
+
+            /// @brief 최근 구간들을 합친 분포
+            /// @param buckets 합칠 최근 구간 수
+            bool getDistribution(Sensor::ChannelId channel, size_t buckets, std::vector<uint64_t>& counts) const;
+
+            /// @brief 빈 경계 (bins + 1개)
+            bool getBinEdges(Sensor::ChannelId channel, std::vector<float>& edges) const;
+
+            /// @brief 범위 밖 값 개수
+            uint64_t getOutOfRangeCount(Sensor::ChannelId channel) const;
+
+            const HistogramConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
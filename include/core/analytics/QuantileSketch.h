@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief KLL 분위수 스케치
+        /// @details 레벨 h의 값은 가중치 2^h를 가진다. 전체 크기가 용량 합을 넘으면
+        ///          넘친 레벨을 정렬 후 한 칸씩 건너 뛰며 절반만 위 레벨로 올린다.
+        ///          위 레벨일수록 용량이 크고 아래로 갈수록 (2/3)배씩 줄어들어
+        ///          전체 크기는 약 3k로 제한된다.
+        ///          같은 k의 스케치끼리 병합 가능 (디바이스/시간 구간 합산).
+        ///          순위 오차는 대략 1.7 / k (k = 200이면 약 0.9%).
+        class QuantileSketch {
+        public:
+            explicit QuantileSketch(uint16_t k = 200);
+
+            void add(float value);
+            void add(const float* values, size_t count);   // NaN은 건너뜀
+            void merge(const QuantileSketch& other);
+            void clear();
+
+            /// @brief 분위수 추정 (q는 0~1). 비어 있으면 NaN
+            float quantile(double q) const;
+
+            /// @brief 여러 분위수를 한 번의 정렬로 계산
+            void quantiles(const double* qs, float* out, size_t count) const;
+
+            uint64_t count() const { return n; }
+            bool empty() const { return n == 0; }
+            float min() const { return min_value; }
+            float max() const { return max_value; }
+            uint16_t getK() const { return k; }
+
+            /// @brief 보관 중인 값 개수 (메모리 사용량 지표)
+            size_t retained() const;
+
+        private:
+            size_t capacity(size_t level) const;
+            size_t totalCapacity() const;
+            void compress();
+            void compactLevel(size_t level);
+            void sortedWeights(std::vector<std::pair<float, uint64_t>>& out) const;
+
+            uint16_t k;
+            uint64_t n = 0;
+            float min_value = std::numeric_limits<float>::infinity();
+            float max_value = -std::numeric_limits<float>::infinity();
+            std::vector<std::vector<float>> levels;
+            size_t retained_count = 0;
+            size_t total_capacity = 0;
+            uint64_t compactions = 0;   // 압축 오프셋을 번갈아 고르기 위한 카운터
+        };
+
+        /// @brief 분위수 저장소 설정
+        struct QuantileStoreConfig {
+            std::vector<Sensor::ChannelId> channels;            // 비어 있으면 배치의 모든 채널
+            Time::Timestamp bucket_ns = 10 * Time::kNanosPerSecond;
+            size_t retention_buckets = 360;                      // 디바이스 x 채널마다 보관할 구간 수
+            uint16_t k = 200;
+        };
+
+        /// @brief 디바이스 x 채널 x 시간 구간별 분위수 스케치 저장소
+        /// @details process는 수집 스레드에서, 조회는 UI 스레드에서 호출해도 된다 (내부 잠금).
+        class QuantileStore {
+        public:
+            static constexpr uint32_t kAllDevices = std::numeric_limits<uint32_t>::max();
+
+            explicit QuantileStore(const QuantileStoreConfig& config = QuantileStoreConfig());
+            ~QuantileStore();
+
+            QuantileStore(const QuantileStore&) = delete;
+            QuantileStore& operator=(const QuantileStore&) = delete;
+            QuantileStore(QuantileStore&&) noexcept;
+            QuantileStore& operator=(QuantileStore&&) noexcept;
+
+            /// @brief 수집된 배치 반영 (샘플 타임스탬프로 구간 결정)
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief [from, to) 구간과 겹치는 스케치를 병합
+            /// @param device_id kAllDevices면 전체 디바이스
+            /// @return 값이 하나라도 있으면 true
+            bool query(Sensor::ChannelId channel, Time::Timestamp from, Time::Timestamp to,
+                       QuantileSketch& out, uint32_t device_id = kAllDevices) const;
+
+            /// @brief 구간별 분위수 시계열 (디바이스 병합 후)
+            /// @param starts 구간 시작 시각
+            /// @param values starts.size() x count 행렬 (구간마다 qs 순서)
+            /// @return 구간 개수
+            size_t getBucketQuantiles(Sensor::ChannelId channel, const double* qs, size_t count,
+                                      std::vector<Time::Timestamp>& starts, std::vector<float>& values,
+                                      uint32_t device_id = kAllDevices) const;
+
+            size_t getDeviceCount() const;
+            const QuantileStoreConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include "core/sensor/SensorBatch.h"
+#include "core/time/Clock.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 리샘플링 방식
+        enum class ResampleMethod {
+            HOLD_LAST,     // 격자 시각 이전의 마지막 샘플 값
+            LINEAR,        // 격자 시각을 둘러싼 두 샘플의 선형 보간
+            BUCKET_MEAN    // [격자, 격자 + period) 구간 평균 (빈 구간은 NaN)
+        };
+
+        /// @brief 리샘플러 설정
+        struct ResamplerConfig {
+            Time::Timestamp period = Time::kNanosPerSecond;   // 격자 간격
+            Time::Timestamp origin = 0;                       // 격자 기준 시각 (origin + k * period)
+            ResampleMethod method = ResampleMethod::HOLD_LAST;
+            Time::Timestamp max_gap = 0;   // 샘플 간격이 이보다 크면 그 사이 격자는 건너뜀 (0이면 제한 없음)
+        };
+
+        /// @brief 스트리밍 리샘플러
+        /// @details 한 디바이스의 배치를 순서대로 받아 공통 시간 격자 위의 배치로 변환한다.
+        ///          격자 점은 값이 확정되는 즉시(다음 샘플이 그 시각을 지나갈 때) 출력되므로
+        ///          버퍼링은 채널당 샘플 하나 수준이다. 격자 점의 품질 비트는 그 값을 만든 원본 샘플
+        ///          (HOLD_LAST는 직전 샘플, LINEAR는 양쪽 샘플, BUCKET_MEAN은 구간의 모든 샘플) 비트의 OR이다.
+        class Resampler {
+        public:
+            explicit Resampler(const ResamplerConfig& config = ResamplerConfig());
+            ~Resampler();
+
+            Resampler(const Resampler&) = delete;
+            Resampler& operator=(const Resampler&) = delete;
+            Resampler(Resampler&&) noexcept;
+            Resampler& operator=(Resampler&&) noexcept;
+
+            /// @brief 입력 배치를 처리하고 확정된 격자 점을 out 뒤에 추가
+            /// @return 추가된 격자 점 개수
+            size_t process(const Sensor::SensorBatch& in, Sensor::SensorBatch& out);
+
+            /// @brief BUCKET_MEAN에서 아직 닫히지 않은 구간을 강제로 출력
+            /// @return 추가된 격자 점 개수
+            size_t flush(Sensor::SensorBatch& out);
+
+            void reset();
+            const ResamplerConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+        /// @brief 타임스탬프를 가장 가까운 격자 인덱스로 변환
+        int64_t gridIndex(Time::Timestamp t, Time::Timestamp origin, Time::Timestamp period);
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 단일 신호용 슬라이딩 DFT
+        /// @details 새 샘플 하나마다 모든 빈을 O(bins)로 갱신한다.
+        ///          X_k <- (X_k + x_new - x_old) * e^{j2πk/N}
+        ///          누적 오차는 N * kResyncWindows 샘플마다 창 전체로 다시 계산해 제거한다.
+        class SlidingDft {
+        public:
+            explicit SlidingDft(size_t window = 64);
+
+            void push(float sample);
+            void reset();
+
+            size_t getWindow() const { return window; }
+            size_t getBinCount() const { return bins.size(); }   // window / 2 + 1 (실수 신호)
+            bool isReady() const { return filled >= window; }
+
+            /// @brief 진폭 스펙트럼 (bin 0은 평균, 나머지는 사인파 진폭 단위)
+            /// @param hann 주파수 영역 3탭 합성곱으로 Hann 창 적용
+            void getMagnitudes(float* out, bool hann = true) const;
+
+        private:
+            static constexpr size_t kResyncWindows = 64;
+
+            void resync();
+
+            size_t window;
+            std::vector<std::complex<double>> bins;
+            std::vector<std::complex<double>> twiddles;
+            std::vector<double> history;   // 최근 window개 입력 (링 버퍼)
+            size_t head = 0;
+            size_t filled = 0;
+            size_t since_resync = 0;
+        };
+
+        /// @brief 스펙트럼 분석 설정
+        struct SpectralConfig {
+            size_t window = 64;                 // DFT 길이, 짝수로 올림 (주파수 해상도 = 샘플레이트 / window)
+            size_t decimation = 1;              // 이 개수만큼 평균낸 뒤 DFT에 넣음 (고속 채널 비용 제한)
+            size_t spectrogram_hop = 8;         // 몇 샘플(데시메이션 후)마다 스펙트로그램 열을 추가할지
+            size_t spectrogram_columns = 64;    // 보관할 스펙트로그램 열 수
+            bool hann = true;
+        };
+
+        /// @brief 선택한 채널들의 실시간 스펙트럼/스펙트로그램
+        /// @details 디바이스 x 채널마다 SlidingDft를 유지한다. process는 수집 스레드에서,
+        ///          조회 함수는 UI 스레드에서 호출해도 된다 (내부 잠금, 조회는 복사본 반환).
+        class SpectralAnalyzer {
+        public:
+            explicit SpectralAnalyzer(const SpectralConfig& config = SpectralConfig());
+            ~SpectralAnalyzer();
+
+            SpectralAnalyzer(const SpectralAnalyzer&) = delete;
+            SpectralAnalyzer& operator=(const SpectralAnalyzer&) = delete;
+            SpectralAnalyzer(SpectralAnalyzer&&) noexcept;
+            SpectralAnalyzer& operator=(SpectralAnalyzer&&) noexcept;
+
+            /// @brief 분석할 채널 선택/해제 (모든 디바이스에 적용)
+            void addChannel(Sensor::ChannelId channel);
+            void removeChannel(Sensor::ChannelId channel);
+            bool hasChannel(Sensor::ChannelId channel) const;
+
+            /// @brief 수집된 배치 반영
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief 현재 진폭 스펙트럼
+            /// @param magnitudes getBinCount()개 값
+            /// @param bin_hz 빈 간격 (Hz, 샘플레이트 추정값 기반)
+            /// @return 창이 채워졌으면 true
+            bool getSpectrum(uint32_t device_id, Sensor::ChannelId channel,
+                             std::vector<float>& magnitudes, double& bin_hz) const;
+
+            /// @brief 스펙트로그램 (ImPlot::PlotHeatmap 형식: 행 = 주파수 빈(위가 고주파), 열 = 시간(오른쪽이 최신))
+            /// @return 열이 하나라도 있으면 true
+            bool getSpectrogram(uint32_t device_id, Sensor::ChannelId channel,
+                                std::vector<float>& values, size_t& rows, size_t& cols) const;
+
+            size_t getBinCount() const;
+            const SpectralConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+#include "core/time/Clock.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 시간 정렬된 다중 디바이스 프레임 묶음
+        /// @details values는 [frame][stream][channel] 순서의 연속 배열이며
+        ///          값이 없는 칸은 NaN, present[frame][stream]은 0으로 표시된다.
+        struct AlignedBatch {
+            size_t stream_count = 0;
+            size_t channel_count = 0;
+            std::vector<Time::Timestamp> timestamps_ns;
+            std::vector<float> values;
+            std::vector<uint8_t> present;
+
+            size_t size() const { return timestamps_ns.size(); }
+            bool empty() const { return timestamps_ns.empty(); }
+
+            float value(size_t frame, size_t stream, size_t channel) const {
+                return values[(frame * stream_count + stream) * channel_count + channel];
+            }
+            bool isPresent(size_t frame, size_t stream) const {
+                return present[frame * stream_count + stream] != 0;
+            }
+            void clear();
+        };
+
+        /// @brief 조인 설정
+        struct JoinConfig {
+            Time::Timestamp period = Time::kNanosPerSecond;   // 입력이 올라가 있는 격자 간격
+            Time::Timestamp origin = 0;
+            size_t channels = Sensor::kSensorChannelCount;
+            size_t max_buffered_frames = 1024;   // 대기 프레임 상한 (넘으면 가장 오래된 프레임부터 강제 출력, 그 사이 빈 구간은 건너뜀)
+            Time::Timestamp max_lateness = 0;    // 가장 앞선 스트림보다 이만큼 뒤처진 스트림은 기다리지 않음 (0이면 무한 대기)
+        };
+
+        /// @brief 워터마크 기반 k-way 시간 정렬 조인
+        /// @details 각 스트림(디바이스)은 같은 격자로 리샘플링된 배치를 보낸다.
+        ///          모든 스트림의 워터마크(마지막으로 받은 격자 시각)의 최솟값까지의
+        ///          프레임은 더 이상 바뀌지 않으므로 출력된다. 늦은 스트림은
+        ///          max_lateness와 max_buffered_frames로 대기 시간이 제한된다.
+        class TimeAlignedJoin {
+        public:
+            explicit TimeAlignedJoin(const JoinConfig& config = JoinConfig());
+            ~TimeAlignedJoin();
+
+            TimeAlignedJoin(const TimeAlignedJoin&) = delete;
+            TimeAlignedJoin& operator=(const TimeAlignedJoin&) = delete;
+            TimeAlignedJoin(TimeAlignedJoin&&) noexcept;
+            TimeAlignedJoin& operator=(TimeAlignedJoin&&) noexcept;
+
+            /// @brief 스트림 등록 (프레임을 출력하기 전에 등록하는 것을 권장)
+            /// @return 스트림 인덱스 (AlignedBatch의 stream 위치)
+            size_t addStream(uint32_t device_id);
+
+            size_t getStreamCount() const;
+
+            /// @brief 리샘플링된 배치를 넣고 완성된 프레임을 out 뒤에 추가
+            /// @return 출력된 프레임 개수
+            size_t push(const Sensor::SensorBatch& resampled, AlignedBatch& out);
+
+            /// @brief 대기 중인 모든 프레임 출력
+            size_t flush(AlignedBatch& out);
+
+            /// @brief 전체 워터마크 (이 시각까지의 프레임은 출력 완료)
+            Time::Timestamp getWatermark() const;
+
+            /// @brief 이미 출력된 시각에 도착해 버려진 샘플 수
+            uint64_t getLateSampleCount() const;
+
+            /// @brief 시각이 max_buffered_frames 이상 건너뛰어 만들지 않고 넘어간 빈 프레임 수
+            uint64_t getSkippedFrameCount() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        /// @brief 트리거 원인
+        enum class TriggerSource {
+            MANUAL,
+            ALERT,
+            MOTION_EDGE
+        };
+
+        /// @brief 트리거 전후 구간을 원본 수집 속도 그대로 담은 캡처
+        struct Capture {
+            uint64_t id = 0;
+            uint32_t device_id = 0;
+            TriggerSource source = TriggerSource::MANUAL;
+            Time::Timestamp trigger_ns = 0;
+            size_t trigger_index = 0;                      // 트리거 이후 첫 샘플 위치
+            bool truncated = false;                        // 링이 최대 크기라 트리거 전 구간 앞부분이 빠짐
+            std::vector<Time::Timestamp> timestamps_ns;
+            std::vector<std::vector<float>> columns;       // columns[channel][sample]
+        };
+
+        /// @brief 캡처 설정
+        struct CaptureConfig {
+            Time::Timestamp pre_trigger_ns = 5 * Time::kNanosPerSecond;
+            Time::Timestamp post_trigger_ns = 5 * Time::kNanosPerSecond;
+            size_t ring_capacity = 4096;        // 디바이스당 링 초기 샘플 수 (2의 거듭제곱으로 올림)
+            size_t max_ring_capacity = 1 << 20; // 링이 pre_trigger_ns를 다 담지 못하면 이 크기까지 두 배씩 늘림
+            bool trigger_on_motion_edge = false;
+            size_t max_completed = 16;          // 가져가지 않은 완료 캡처 보관 한도
+        };
+
+        /// @brief 오실로스코프식 트리거 캡처
+        /// @details 디바이스마다 링에 최근 샘플을 계속 덮어쓴다. 덮어쓸 가장 오래된 샘플이 아직
+        ///          pre_trigger_ns 안이면 (수집 속도에 비해 링이 작으면) max_ring_capacity까지 두 배로 늘린다.
+        ///          링은 수집 스레드 하나만 쓰므로 잠금이 없고, 다른 스레드의 트리거 요청은 원자 카운터로 표시만 한다.
+        ///          트리거 시각이 지나는 샘플에서 링의 트리거 전 구간을 복사해 캡처를 열고,
+        ///          이후 post_trigger_ns 동안의 샘플을 이어 붙인 뒤 완료 목록으로 넘긴다.
+        ///          캡처가 열려 있는 동안 같은 디바이스에서 시각이 지난 트리거는 버리고 무시 횟수에 센다.
+        class TriggerCapture {
+        public:
+            explicit TriggerCapture(const CaptureConfig& config = CaptureConfig());
+            ~TriggerCapture();
+
+            TriggerCapture(const TriggerCapture&) = delete;
+            TriggerCapture& operator=(const TriggerCapture&) = delete;
+            TriggerCapture(TriggerCapture&&) noexcept;
+            TriggerCapture& operator=(TriggerCapture&&) noexcept;
+
+            /// @brief 수집 배치 반영 (수집 스레드에서만 호출)
+            void process(const Sensor::SensorBatch& batch);
+
+            /// @brief 트리거 요청 (어느 스레드에서든 호출 가능)
+            /// @param at 트리거 시각 (이 시각을 지나는 샘플에서 발동)
+            void trigger(TriggerSource source, uint32_t device_id, Time::Timestamp at);
+
+            /// @brief 모션 시작 트리거 켜기/끄기 (어느 스레드에서든 호출 가능)
+            void setMotionTrigger(bool enabled);
+            bool getMotionTrigger() const;
+
+            /// @brief 완료된 캡처를 가져감
+            /// @return 가져간 개수
+            size_t takeCompleted(std::vector<Capture>& out);
+
+            /// @brief 진행 중인 캡처 수
+            size_t getActiveCount() const;
+
+            /// @brief 캡처 진행 중이라 무시된 트리거 수
+            uint64_t getIgnoredTriggerCount() const;
+
+            const CaptureConfig& getConfig() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+        /// @brief 캡처를 CSV로 저장 (첫 열은 트리거 기준 상대 초)
+        /// @param names 채널 이름 (nullptr이면 기본 채널 이름)
+        bool writeCaptureCsv(const Capture& capture, const std::string& path,
+                             const Sensor::ChannelRegistry* names = nullptr);
+
+        const char* triggerSourceName(TriggerSource source);
+
+    } // namespace Analytics
+} // namespace DachshundEngine
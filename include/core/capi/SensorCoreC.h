@@ -0,0 +1,160 @@
+#ifndef DACHSHUND_SENSOR_CORE_C_H
+#define DACHSHUND_SENSOR_CORE_C_H
+
+/*
+ * SensorCore C ABI (libdachshund_sensor)
+ * 다른 컴파일러/런타임(C, Python ctypes, Rust 등)에서 쓰는 안정 인터페이스.
+ * C++ 타입은 노출하지 않고 불투명 핸들, 고정 폭 구조체, 함수 포인터 + user_data만 쓴다.
+ * 구조체에는 필드를 뒤에만 추가하며, 배치가 바뀌면 DSH_ABI_VERSION을 올린다.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+    #if defined(DSH_BUILDING_LIBRARY)
+        #define DSH_API __declspec(dllexport)
+    #else
+        #define DSH_API __declspec(dllimport)
+    #endif
+#else
+    #define DSH_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DSH_ABI_VERSION 1u
+
+/** @brief 불투명 매니저 핸들 (SensorDataManager 하나) */
+typedef struct dsh_manager dsh_manager;
+
+typedef enum dsh_status {
+    DSH_OK = 0,
+    DSH_ERR_INVALID_ARGUMENT = -1,
+    DSH_ERR_NOT_FOUND = -2,
+    DSH_ERR_FAILED = -3,                /* 자세한 이유는 dsh_last_error() */
+    DSH_ERR_BUFFER_TOO_SMALL = -4
+} dsh_status;
+
+typedef enum dsh_mode {
+    DSH_MODE_MOCK = 0,
+    DSH_MODE_RASPBERRY_PI = 1
+} dsh_mode;
+
+/** @brief 샘플 한 개의 메타데이터 (값은 별도 배열) */
+typedef struct dsh_sample_info {
+    int64_t timestamp_ns;
+    uint32_t device_id;
+    uint32_t quality;                   /* 검증 품질 비트 (bit n = 채널 n, 0이면 정상) */
+} dsh_sample_info;
+
+/** @brief 콜백에 넘어가는 배치 (파이프라인 버퍼를 그대로 가리키며 콜백 안에서만 유효) */
+typedef struct dsh_batch_view {
+    uint32_t device_id;
+    uint32_t channel_count;
+    size_t sample_count;
+    const int64_t* timestamps_ns;       /* [sample_count] */
+    const uint32_t* quality;            /* [sample_count] */
+    const float* const* columns;        /* [channel_count][sample_count] */
+} dsh_batch_view;
+
+/** @brief 알림 전이 (규칙 상태가 바뀔 때마다 하나) */
+typedef struct dsh_alert {
+    uint32_t rule_id;
+    uint32_t device_id;
+    uint16_t channel;
+    uint8_t raised;                     /* 1: 발생, 0: 해제 */
+    uint8_t severity;                   /* 0: INFO, 1: WARNING, 2: CRITICAL */
+    float value;
+    int64_t timestamp_ns;
+} dsh_alert;
+
+/* 콜백은 파이프라인을 돌리는 스레드(샘플링 스레드 또는 dsh_manager_poll 호출 스레드)에서 불린다.
+ * 콜백 안에서 dsh_manager_stop_sampling / dsh_manager_destroy / dsh_manager_remove_batch_callback을 부르지 않는다. */
+typedef void (*dsh_batch_callback)(void* user_data, const dsh_batch_view* batch);
+typedef void (*dsh_alert_callback)(void* user_data, const dsh_alert* alert);
+
+/** @brief 라이브러리의 DSH_ABI_VERSION (헤더 값과 다르면 쓰지 않음) */
+DSH_API uint32_t dsh_abi_version(void);
+
+/** @brief 이 스레드에서 마지막으로 실패한 호출의 이유 (다음 호출 전까지 유효) */
+DSH_API const char* dsh_last_error(void);
+
+DSH_API dsh_manager* dsh_manager_create(dsh_mode mode);
+DSH_API void dsh_manager_destroy(dsh_manager* manager);
+
+DSH_API dsh_status dsh_manager_set_mode(dsh_manager* manager, dsh_mode mode);
+DSH_API dsh_status dsh_manager_connect(dsh_manager* manager, const char* host, int port);
+DSH_API void dsh_manager_disconnect(dsh_manager* manager);
+DSH_API int dsh_manager_is_connected(dsh_manager* manager);
+
+/** @brief 수집 주기 (밀리초) */
+DSH_API dsh_status dsh_manager_set_update_interval(dsh_manager* manager, float milliseconds);
+
+/** @brief 전용 샘플링 스레드 시작/정지. 스레드 없이 쓰려면 dsh_manager_poll을 주기적으로 호출 */
+DSH_API dsh_status dsh_manager_start_sampling(dsh_manager* manager);
+DSH_API void dsh_manager_stop_sampling(dsh_manager* manager);
+DSH_API dsh_status dsh_manager_poll(dsh_manager* manager);
+
+/**
+ * @brief 등록된 소스 종류로 기본 설정 소스를 추가하고 시작 (dsh_manager_add_source_config에 config = NULL)
+ * @return 시작에 실패하면 DSH_ERR_FAILED (이유는 dsh_last_error, 예: 포트를 열 수 없음)
+ */
+DSH_API dsh_status dsh_manager_add_source(dsh_manager* manager, const char* type, uint32_t device_id,
+                                          uint32_t* out_source_id);
+
+/**
+ * @brief 설정 문자열로 소스를 만들어 추가하고 시작
+ * @param type "mock", "raspberry_pi", "host", "serial", "mqtt" (그 외 등록 종류는 config 없이만)
+ * @param config "key=value;key=value" 또는 NULL (기본값). 값에 ';'는 쓸 수 없다
+ *   host:   sample_rate_hz, hwmon_root, proc_root, hwmon_name
+ *   serial: device, baud, framing=line|binary, delimiter, fields=<채널,채널,...> (이름 또는 번호)
+ *   mqtt:   host, port, client_id, username, password, keep_alive_s, qos,
+ *           route=<토픽>><채널>[@<디바이스 ID 토픽 단계>] (여러 번, 하나 이상 필요. 단계가 없으면 device_id)
+ *   예: "device=/dev/ttyUSB0;baud=9600;framing=line"
+ *       "host=10.0.0.5;route=sensors/+/temperature>temperature@1;route=sensors/+/humidity>humidity@1"
+ * @return 설정이 잘못되면 DSH_ERR_INVALID_ARGUMENT, 모르는 종류면 DSH_ERR_NOT_FOUND, 시작 실패는 DSH_ERR_FAILED
+ */
+DSH_API dsh_status dsh_manager_add_source_config(dsh_manager* manager, const char* type, uint32_t device_id,
+                                                 const char* config, uint32_t* out_source_id);
+DSH_API dsh_status dsh_manager_remove_source(dsh_manager* manager, uint32_t source_id);
+
+/** @brief 채널 수와 이름 (capacity가 모자라면 DSH_ERR_BUFFER_TOO_SMALL) */
+DSH_API uint32_t dsh_manager_channel_count(dsh_manager* manager);
+DSH_API dsh_status dsh_manager_channel_name(dsh_manager* manager, uint32_t channel, char* buffer, size_t capacity);
+
+/**
+ * @brief 일괄 읽기용 샘플 큐 켜기 (다시 부르면 비우고 크기 변경)
+ * @param capacity 보관할 최대 샘플 수 (넘치면 가장 오래된 샘플부터 버림)
+ * @param channel_count 샘플당 값 개수 (채널 ID 순서, 없는 채널은 NaN)
+ */
+DSH_API dsh_status dsh_manager_enable_queue(dsh_manager* manager, size_t capacity, uint32_t channel_count);
+
+/**
+ * @brief 큐에서 샘플을 꺼내 호출자 배열에 채움
+ * @param infos [max_samples] 또는 NULL
+ * @param values [max_samples * channel_count] 행 우선 (values[i * channel_count + ch]) 또는 NULL
+ * @return 꺼낸 샘플 수
+ */
+DSH_API size_t dsh_manager_read_samples(dsh_manager* manager, dsh_sample_info* infos, float* values,
+                                        size_t max_samples);
+
+/** @brief 큐가 넘쳐 버린 누적 샘플 수 */
+DSH_API uint64_t dsh_manager_dropped_samples(dsh_manager* manager);
+
+/** @brief 배치 콜백 등록 (수집된 배치마다 복사 없이 호출). 반환 ID로 해제 */
+DSH_API dsh_status dsh_manager_add_batch_callback(dsh_manager* manager, dsh_batch_callback callback,
+                                                  void* user_data, uint32_t* out_callback_id);
+DSH_API dsh_status dsh_manager_remove_batch_callback(dsh_manager* manager, uint32_t callback_id);
+
+/** @brief 알림 콜백 설정 (callback이 NULL이면 해제) */
+DSH_API dsh_status dsh_manager_set_alert_callback(dsh_manager* manager, dsh_alert_callback callback,
+                                                  void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DACHSHUND_SENSOR_CORE_C_H */
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include "core/sensor/SensorManager.h"
+#include "core/sensor/SensorBatch.h"
+#include "core/network/NetworkClient.h"
+#include "core/alert/AlertEngine.h"
+#include "core/analytics/AnomalyDetector.h"
+
+namespace DachshundEngine {
+    namespace Event {
+
+        /// @brief 센서 샘플 이벤트
+        struct SampleEvent {
+            static constexpr size_t kMaxExtraChannels = Sensor::kMaxExtendedChannels;
+
+            uint32_t device_id = 0;
+            Sensor::SensorData data;
+            uint16_t extra_count = 0;                            // 확장 채널(파생 채널 등) 개수
+            std::array<float, kMaxExtraChannels> extra{};        // extra[i] = 채널 kSensorChannelCount + i
+
+            /// @brief 채널 ID로 값 읽기 (없는 채널은 NaN)
+            float channel(Sensor::ChannelId id) const;
+        };
+
+        /// @brief 연결 상태 변경 이벤트
+        struct ConnectionEvent {
+            uint32_t device_id = 0;
+            Network::ConnectionState state = Network::ConnectionState::DISCONNECTED;
+        };
+
+        /// @brief 모듈 간 명령 이벤트 (UI -> 센서/네트워크 등)
+        struct CommandEvent {
+            uint32_t device_id = 0;
+            char command[32] = {};   // 예: "set_sampling_rate"
+            float value = 0.0f;
+        };
+
+        /// @brief 버스 이벤트 종류 (payload variant 인덱스와 동일한 순서)
+        enum class EventType : uint8_t {
+            SENSOR_SAMPLE,
+            ALERT,
+            CONNECTION_STATE,
+            COMMAND,
+            ANOMALY
+        };
+
+        /// @brief 버스로 전달되는 이벤트 (슬롯에 그대로 저장되는 고정 크기 값 타입)
+        struct BusEvent {
+            Time::Timestamp timestamp_ns = 0;
+            std::variant<SampleEvent, Alert::AlertEvent, ConnectionEvent, CommandEvent,
+                         Analytics::AnomalyEvent> payload;
+
+            EventType type() const { return static_cast<EventType>(payload.index()); }
+        };
+
+        /// @brief 명령 이벤트 생성 헬퍼
+        BusEvent makeCommandEvent(const std::string& command, float value, uint32_t device_id = 0);
+
+        using SubscriberId = uint32_t;
+
+        static_assert(std::is_trivially_copyable_v<BusEvent>, "bus slots are copied while they may be overwritten");
+
+        /// @brief Disruptor 방식의 사전 할당 링 버퍼 이벤트 버스
+        /// @details 발행자는 슬롯을 하나 점유해 값을 쓰고 슬롯 시퀀스를 공개한다.
+        ///          구독자마다 독립된 시퀀스 커서를 가지고 각자 속도로 읽는다.
+        ///          발행자는 구독자를 기다리지 않고 가장 오래된 슬롯을 덮어쓰므로 (공유 메모리 링과 같은 방식)
+        ///          멈춘 구독자가 다른 구독자의 수신을 막지 않는다. 슬롯 시퀀스를 0으로 내린 뒤 값을 쓰고
+        ///          시퀀스 + 1을 공개하며, 구독자는 슬롯을 복사한 뒤 시퀀스를 다시 확인해 덮어쓰기를 알아챈다.
+        ///          한 바퀴 이상 뒤처진 구독자는 남은 구간의 앞쪽으로 건너뛰고 건너뛴 수를 자기 누락으로 센다.
+        ///          구독자 하나는 한 스레드에서만 poll 해야 한다.
+        class EventBus {
+        public:
+            static constexpr size_t kMaxSubscribers = 32;
+            static constexpr SubscriberId kInvalidSubscriber = std::numeric_limits<SubscriberId>::max();
+
+            /// @param capacity 슬롯 개수 (2의 거듭제곱으로 올림)
+            explicit EventBus(size_t capacity = 4096);
+            ~EventBus();
+
+            EventBus(const EventBus&) = delete;
+            EventBus& operator=(const EventBus&) = delete;
+
+            /// @brief 이벤트 발행 (대기 없음, 가장 오래된 슬롯을 덮어씀)
+            /// @return 항상 true (구독자별 누락은 getMissedCount)
+            bool publish(const BusEvent& event);
+
+            /// @brief 구독자 등록 (등록 이후 발행된 이벤트부터 수신)
+            /// @return 구독자 ID, 슬롯이 없으면 kInvalidSubscriber
+            SubscriberId subscribe(const std::string& name);
+
+            /// @brief 구독 해제
+            void unsubscribe(SubscriberId id);
+
+            /// @brief 구독자에게 도착한 이벤트를 순서대로 처리
+            /// @param handler const BusEvent& 를 받는 호출 가능 객체 (슬롯에서 복사한 값, 호출 동안만 유효)
+            /// @param max_events 이번 호출에서 처리할 최대 개수
+            /// @return 처리한 이벤트 개수
+            template <typename Handler>
+            size_t poll(SubscriberId id, Handler&& handler,
+                        size_t max_events = std::numeric_limits<size_t>::max()) {
+                if (id >= kMaxSubscribers) {
+                    return 0;
+                }
+                Cursor& cursor = cursors[id];
+                uint64_t next = cursor.next.load(std::memory_order_relaxed);
+                size_t processed = 0;
+                while (processed < max_events) {
+                    const Slot& slot = slots[next & mask];
+                    if (slot.sequence.load(std::memory_order_acquire) != next + 1) {
+                        if (!skipLapped(cursor, next)) {
+                            break;      // 아직 발행되지 않음
+                        }
+                        continue;
+                    }
+                    // 읽는 동안 덮어써졌을 수 있으므로 복사한 뒤 시퀀스 재확인
+                    const BusEvent event = slot.event;
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot.sequence.load(std::memory_order_relaxed) != next + 1) {
+                        skipLapped(cursor, next);
+                        continue;
+                    }
+                    handler(event);
+                    ++next;
+                    ++processed;
+                }
+                cursor.next.store(next, std::memory_order_release);
+                return processed;
+            }
+
+            /// @brief 구독자가 아직 처리하지 않은 이벤트 개수
+            uint64_t getLag(SubscriberId id) const;
+
+            size_t getCapacity() const { return slots_count; }
+            uint64_t getPublishedCount() const;
+            /// @brief 모든 구독자가 덮어쓰기로 놓친 이벤트 합계 (해제된 구독자 포함)
+            uint64_t getDroppedCount() const;
+            /// @brief 구독자 하나가 놓친 이벤트 수
+            uint64_t getMissedCount(SubscriberId id) const;
+            std::string getSubscriberName(SubscriberId id) const;
+
+        private:
+            static constexpr size_t kCacheLine = 64;
+
+            struct alignas(kCacheLine) Slot {
+                std::atomic<uint64_t> sequence{0};   // 공개된 시퀀스 + 1 (0이면 비어 있음)
+                BusEvent event;
+            };
+
+            struct alignas(kCacheLine) Cursor {
+                std::atomic<uint64_t> next{0};       // 다음에 읽을 시퀀스
+                std::atomic<uint64_t> missed{0};     // 덮어써져 건너뛴 이벤트 수
+                std::atomic<bool> active{false};
+                std::string name;
+            };
+
+            /// @brief next가 덮어써졌으면 남은 가장 오래된 시퀀스로 옮기고 누락을 셈
+            /// @return 옮겼으면 true, 아직 발행되지 않은 것이면 false
+            bool skipLapped(Cursor& cursor, uint64_t& next);
+
+            std::unique_ptr<Slot[]> slots;
+            size_t slots_count;
+            uint64_t mask;
+            std::array<Cursor, kMaxSubscribers> cursors;
+
+            alignas(kCacheLine) std::atomic<uint64_t> claim{0};
+            alignas(kCacheLine) std::atomic<uint64_t> dropped{0};
+            mutable std::mutex subscriber_mutex;    // 구독 등록/해제 전용 (발행/poll 경로에서는 사용 안 함)
+        };
+
+    } // namespace Event
+} // namespace DachshundEngine
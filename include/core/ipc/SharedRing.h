@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Ipc {
+
+        // 공유 메모리 레이아웃 (다른 언어의 리더도 읽을 수 있도록 고정 폭 필드만 사용, 리틀 엔디언)
+        //   [SharedRingHeader][채널 이름 char[32] × channel_count][64바이트 정렬][슬롯 × slot_count]
+        //   슬롯 = [SharedRingSlotHeader][float × channel_count], slot_bytes 단위로 64바이트 정렬
+        constexpr uint32_t kSharedRingMagic = 0x4D485344;      // "DSHM"
+        constexpr uint16_t kSharedRingVersionMajor = 1;         // 레이아웃이 바뀌면 올림 (리더는 다르면 거부)
+        constexpr uint16_t kSharedRingVersionMinor = 0;         // 뒤쪽 여유 공간에 필드만 추가되면 올림
+        constexpr size_t kSharedRingMaxReaders = 16;
+        constexpr size_t kSharedRingNameBytes = 32;
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared ring needs address-free 64-bit atomics");
+
+        /// @brief 리더 등록 칸 (리더 프로세스가 직접 갱신, 작성자는 지연 확인용으로만 읽음)
+        struct alignas(64) SharedRingReaderEntry {
+            std::atomic<int32_t> pid;                   // 0이면 빈 칸
+            uint32_t reserved;
+            std::atomic<uint64_t> cursor;               // 다음에 읽을 시퀀스
+            std::atomic<uint64_t> missed;               // 덮어써져 건너뛴 샘플 수
+            char name[kSharedRingNameBytes];
+        };
+
+        /// @brief 링 헤더 (magic은 초기화가 끝난 뒤 마지막에 기록)
+        struct alignas(64) SharedRingHeader {
+            std::atomic<uint32_t> magic;
+            uint16_t version_major;
+            uint16_t version_minor;
+            uint32_t header_bytes;                      // sizeof(SharedRingHeader)
+            uint32_t names_offset;                      // 채널 이름 표 시작
+            uint32_t slots_offset;                      // 슬롯 배열 시작
+            uint32_t slot_bytes;
+            uint64_t slot_count;                        // 2의 거듭제곱
+            uint32_t channel_count;                     // 슬롯당 값 개수 (채널 ID 순서, 없는 채널은 NaN)
+            std::atomic<int32_t> writer_pid;            // 작성자가 닫으면 0
+            alignas(64) std::atomic<uint64_t> write_sequence;  // 다음에 쓸 시퀀스 (= 지금까지 쓴 샘플 수)
+            std::atomic<uint32_t> names_generation;     // 이름 표를 고치는 동안 홀수
+            alignas(64) SharedRingReaderEntry readers[kSharedRingMaxReaders];
+        };
+
+        /// @brief 슬롯 머리 (값 배열이 바로 뒤에 붙음)
+        struct SharedRingSlotHeader {
+            std::atomic<uint64_t> sequence;             // 공개된 시퀀스 + 1 (쓰는 중이면 0)
+            int64_t timestamp_ns;
+            uint32_t device_id;
+            uint32_t quality;
+        };
+
+        /// @brief 링 설정
+        struct SharedRingConfig {
+            std::string name = "/dachshund_samples";    // shm_open 이름 ('/'로 시작)
+            size_t slot_count = 16384;                  // 2의 거듭제곱으로 올림
+            size_t channel_count = 32;                  // 이보다 뒤 채널은 내보내지 않음
+            uint32_t permissions = 0660;                // 리더도 커서를 쓰므로 읽기/쓰기 권한 필요
+        };
+
+        /// @brief 리더가 받는 샘플 한 개 (values는 poll 호출 동안만 유효)
+        struct SharedSample {
+            uint64_t sequence = 0;
+            Time::Timestamp timestamp_ns = 0;
+            uint32_t device_id = 0;
+            uint32_t quality = 0;
+            const float* values = nullptr;
+            size_t channel_count = 0;
+        };
+
+        /// @brief 작성자가 보는 리더 상태
+        struct SharedRingReaderInfo {
+            std::string name;
+            int32_t pid = 0;
+            uint64_t lag = 0;                           // 아직 읽지 않은 샘플 수
+            uint64_t missed = 0;
+        };
+
+        /// @brief 공유 메모리 링 작성자 (한 링에 작성자 하나, POSIX shm)
+        /// @details 리더를 기다리지 않고 가장 오래된 슬롯을 덮어쓴다. 슬롯마다 시퀀스를 0으로 내린 뒤
+        ///          값을 쓰고 시퀀스 + 1을 공개하므로 리더는 읽기 전후 시퀀스를 비교해 덮어쓰기를 알아챈다.
+        ///          같은 이름의 기존 세그먼트는 지우고 새로 만든다 (남아 있던 리더는 writer_pid == 0을 보고 다시 연다).
+        class SharedRingWriter {
+        public:
+            SharedRingWriter();
+            ~SharedRingWriter();
+
+            SharedRingWriter(const SharedRingWriter&) = delete;
+            SharedRingWriter& operator=(const SharedRingWriter&) = delete;
+
+            /// @brief 세그먼트 생성 및 매핑
+            /// @return 실패하면 false (getLastError()에 이유)
+            bool open(const SharedRingConfig& config = SharedRingConfig());
+
+            /// @brief 매핑 해제 및 세그먼트 삭제 (이미 연 리더는 매핑이 풀릴 때까지 계속 읽을 수 있음)
+            void close();
+            bool isOpen() const;
+
+            /// @brief 채널 이름 표 갱신 (앞에서부터 channel_count 개)
+            void setChannelNames(const Sensor::ChannelRegistry& registry);
+
+            /// @brief 배치의 샘플을 순서대로 기록 (대기 없음)
+            /// @return 기록한 샘플 수
+            size_t write(const Sensor::SensorBatch& batch);
+
+            uint64_t getWrittenCount() const;
+            std::vector<SharedRingReaderInfo> getReaders() const;
+            const SharedRingConfig& getConfig() const;
+            std::string getLastError() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+        /// @brief 공유 메모리 링 리더 (다른 프로세스에서 사용, 리더 하나는 한 스레드에서만 poll)
+        /// @details 세그먼트를 읽기/쓰기로 매핑해 등록 칸 하나를 점유하고 자기 커서를 공개한다.
+        ///          죽은 프로세스가 남긴 칸은 재사용한다. 등록 이후 기록된 샘플부터 읽으며, 링 한 바퀴
+        ///          이상 뒤처지면 남은 구간의 앞쪽으로 건너뛰고 건너뛴 수를 missed에 더한다.
+        class SharedRingReader {
+        public:
+            SharedRingReader();
+            ~SharedRingReader();
+
+            SharedRingReader(const SharedRingReader&) = delete;
+            SharedRingReader& operator=(const SharedRingReader&) = delete;
+
+            /// @brief 링에 연결하고 리더 칸 등록
+            /// @return 세그먼트가 없거나, 버전이 다르거나, 리더 칸이 없으면 false
+            bool open(const std::string& name, const std::string& reader_name);
+            void close();
+            bool isOpen() const;
+
+            /// @brief 작성자 프로세스가 살아 있으면 true (false면 close() 후 다시 open)
+            bool isWriterAlive() const;
+
+            /// @brief 새 샘플을 순서대로 처리
+            /// @details 슬롯을 리더 버퍼로 한 번 복사해 시퀀스를 확인한 뒤 handler에 넘긴다
+            ///          (공유 메모리 위라 소켓/직렬화 없이 마이크로초 단위 지연)
+            /// @return 처리한 샘플 수
+            size_t poll(const std::function<void(const SharedSample&)>& handler, size_t max_samples = std::numeric_limits<size_t>::max());
+
+            /// @brief 아직 읽지 않은 샘플 수
+            uint64_t getLag() const;
+            uint64_t getMissedCount() const;
+
+            size_t getChannelCount() const;
+            /// @brief 채널 이름 (작성자가 이름 표를 고치는 중이면 다시 읽음)
+            std::string getChannelName(size_t channel) const;
+            std::string getLastError() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Ipc
+} // namespace DachshundEngine
@@ -94,8 +94,9 @@ namespace DachshundEngine {
 
         /// @brief JSON 유틸리티 함수들
         namespace JsonUtil {
-            /// @brief SensorData를 JSON 문자열로 변환
-            std::string sensorDataToJson(const Sensor::SensorData& data);
+            /// @brief SensorData를 JSON 문자열로 변환 (sensor_server.py와 같은 형식)
+            /// @param timestamp_ms 송신 시각 (유닉스 밀리초)
+            std::string sensorDataToJson(const Sensor::SensorData& data, uint64_t timestamp_ms = 0);
 
             /// @brief JSON 문자열을 SensorData로 파싱
             bool parseSensorData(const std::string& json, Sensor::SensorData& data);
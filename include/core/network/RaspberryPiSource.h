@@ -0,0 +1,42 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include "core/sensor/SensorSource.h"
+#include "core/network/NetworkClient.h"
+
+namespace DachshundEngine {
+    namespace Network {
+
+        /// @brief 라즈베리파이 센서 서버(sensor_server.py)에서 받는 소스
+        /// @details start()가 설정된 주소로 연결하고, read()가 그동안 도착한 메시지를 처리해
+        ///          받은 샘플을 수신 시각으로 배치에 넣는다.
+        class RaspberryPiSource : public Sensor::SensorSource {
+        public:
+            RaspberryPiSource();
+            ~RaspberryPiSource() override;
+
+            const char* getType() const override;
+            bool start() override;
+            void stop() override;
+            bool isRunning() const override;    // 연결되어 있으면 true
+            size_t read(Sensor::SensorBatch& out, Time::Timestamp now) override;
+            bool handleCommand(const char* command, float value) override;
+            std::string getStatus() const override;
+
+            /// @brief 연결할 서버 주소 (다음 start()부터 적용)
+            void setAddress(const std::string& ip_address, int port);
+
+            /// @brief 연결 상태 변경 콜백 (read() 또는 start()/stop() 안에서 호출됨)
+            void setOnConnectionStateChanged(std::function<void(ConnectionState)> callback);
+
+            NetworkClient& getClient();
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Network
+} // namespace DachshundEngine
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 채널 하나의 보정: y = lut(gain * x + offset)
+        struct ChannelCalibration {
+            float gain = 1.0f;
+            float offset = 0.0f;
+
+            // 선택: [lut_min, lut_max]를 균등 분할한 점에서의 출력값 (점 사이는 선형 보간,
+            // 범위 밖은 끝값으로 고정). 2점 미만이면 선형 보정만 적용
+            float lut_min = 0.0f;
+            float lut_max = 0.0f;
+            std::vector<float> lut;
+
+            bool hasLut() const { return lut.size() >= 2 && lut_max > lut_min; }
+        };
+
+        /// @brief 디바이스/채널별 보정표
+        /// @details 수집 중에는 읽기 전용으로 공유되므로, 수정할 때는 복사본을 고친 뒤
+        ///          SensorDataManager::setCalibration으로 통째로 교체한다.
+        ///          디바이스 항목이 없는 채널은 kAllDevices 항목을 쓴다.
+        class CalibrationTable {
+        public:
+            static constexpr uint32_t kAllDevices = 0xFFFFFFFFu;
+
+            void set(uint32_t device_id, ChannelId channel, const ChannelCalibration& calibration);
+            bool remove(uint32_t device_id, ChannelId channel);
+            void clear();
+
+            /// @brief 디바이스 항목, 없으면 kAllDevices 항목 (둘 다 없으면 nullptr)
+            const ChannelCalibration* find(uint32_t device_id, ChannelId channel) const;
+
+            size_t size() const { return entries.size(); }
+            bool empty() const { return entries.empty(); }
+
+            /// @brief 모든 항목 순회 (디바이스, 채널 순)
+            void forEach(const std::function<void(uint32_t, ChannelId, const ChannelCalibration&)>& fn) const;
+
+            /// @brief 배치의 채널 열 전체에 보정 적용 (채널당 연속 루프 한두 번)
+            void apply(SensorBatch& batch) const;
+
+        private:
+            std::map<uint64_t, ChannelCalibration> entries;   // (device << 16) | channel
+        };
+
+        /// @brief CSV에서 보정표 읽기
+        /// @details 한 줄에 "device,channel,gain,offset[,lut_min,lut_max,y0,y1,...]".
+        ///          device는 숫자 또는 "*"(모든 디바이스), channel은 등록부의 채널 이름.
+        ///          빈 줄과 '#'으로 시작하는 줄은 무시한다.
+        /// @return 성공 여부 (실패 시 error에 줄 번호와 원인)
+        bool loadCalibrationCsv(const std::string& path, const ChannelRegistry& registry,
+                                CalibrationTable& out, std::string& error);
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 사용자 정의 파생 채널 집합
+        /// @details "temperature - (100 - humidity) / 5" 같은 식을 한 번만 파싱해
+        ///          스택 바이트코드로 컴파일하고, 수집 시 배치의 채널 열 전체에 대해
+        ///          명령어 하나당 루프 하나로 평가한다 (자동 벡터화 가능한 형태).
+        ///          지원: + - * / ^, 단항 -, 괄호, 숫자, 채널 이름,
+        ///          min max pow abs sqrt exp log dewpoint(temperature, humidity)
+        class DerivedChannelSet {
+        public:
+            /// @param registry 채널 이름 해석과 새 채널 ID 발급에 사용 (수명이 더 길어야 함)
+            explicit DerivedChannelSet(ChannelRegistry& registry);
+            ~DerivedChannelSet();
+
+            DerivedChannelSet(const DerivedChannelSet&) = delete;
+            DerivedChannelSet& operator=(const DerivedChannelSet&) = delete;
+            DerivedChannelSet(DerivedChannelSet&&) noexcept;
+            DerivedChannelSet& operator=(DerivedChannelSet&&) noexcept;
+
+            /// @brief 파생 채널 정의 (같은 이름이 있으면 식을 교체)
+            /// @param name 채널 이름 (이후 식에서 참조 가능)
+            /// @param expression 식 문자열
+            /// @param out_channel 발급된 채널 ID
+            /// @return 컴파일 성공 여부 (실패 시 getLastError)
+            bool define(const std::string& name, const std::string& expression, ChannelId& out_channel);
+
+            /// @brief 파생 채널 정의 제거 (채널 ID는 등록부에 남는다)
+            bool remove(const std::string& name);
+
+            /// @brief 정의된 파생 채널 개수
+            size_t size() const;
+
+            /// @brief 정의 조회 (index는 0 ~ size()-1)
+            const std::string& getName(size_t index) const;
+            const std::string& getExpression(size_t index) const;
+            ChannelId getChannel(size_t index) const;
+
+            /// @brief 배치에 파생 채널 열을 계산해 채움 (정의 순서대로, 앞선 파생 채널 참조 가능)
+            void evaluate(SensorBatch& batch);
+
+            std::string getLastError() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 평활 필터 종류
+        enum class FilterType {
+            EMA,            // 지수 이동 평균
+            LOWPASS,        // 2차 버터워스 저역 통과 (biquad)
+            MEDIAN          // 짧은 창 중앙값 (스파이크 제거)
+        };
+
+        /// @brief 필터 하나의 정의
+        struct FilterSpec {
+            std::string name;                   // 출력 채널 이름 (비우면 "<원본>_<종류>")
+            ChannelId source = 0;               // 기본 채널만 가능 (보정 후 값)
+            FilterType type = FilterType::EMA;
+            float alpha = 0.2f;                 // EMA: 새 샘플 가중치 (0, 1]
+            float cutoff_hz = 0.5f;             // LOWPASS: 차단 주파수
+            float sample_rate_hz = 10.0f;       // LOWPASS: 원본 샘플링 주기 기준
+            float q = 0.7071f;                  // LOWPASS: 품질 계수
+            size_t window = 5;                  // MEDIAN: 홀수, 3 ~ kMaxMedianWindow
+        };
+
+        const char* filterTypeName(FilterType type);
+
+        /// @brief 수집 시 원본 채널 옆에 평활 채널을 만들어 주는 필터 뱅크
+        /// @details 필터마다 출력 채널을 등록부에 받아 일반 채널처럼 저장/발행된다.
+        ///          상태는 디바이스별로 종류마다 필터 축으로 연속 배치되어 있어서, 샘플 하나에 대해
+        ///          같은 종류의 필터 전부를 한 루프로 갱신한다 (필터 축으로 자동 벡터화 가능한 형태).
+        ///          시간 축은 재귀식이라 벡터화하지 않는다. NaN 입력은 상태를 바꾸지 않고 직전 출력을 유지한다.
+        ///          파생 채널보다 먼저 계산되므로 파생 채널 식에서 필터 출력을 참조할 수 있다.
+        class FilterBank {
+        public:
+            static constexpr size_t kMaxMedianWindow = 15;
+
+            /// @param registry 출력 채널 ID 발급에 사용 (수명이 더 길어야 함)
+            explicit FilterBank(ChannelRegistry& registry);
+            ~FilterBank();
+
+            FilterBank(const FilterBank&) = delete;
+            FilterBank& operator=(const FilterBank&) = delete;
+            FilterBank(FilterBank&&) noexcept;
+            FilterBank& operator=(FilterBank&&) noexcept;
+
+            /// @brief 필터 정의 (같은 출력 이름이 있으면 교체). 정의가 바뀌면 모든 필터 상태를 초기화
+            /// @return 성공 여부 (실패 시 getLastError)
+            bool define(const FilterSpec& spec, ChannelId& out_channel);
+
+            /// @brief 필터 제거 (채널 ID는 등록부에 남는다)
+            bool remove(const std::string& name);
+
+            size_t size() const;
+            const FilterSpec& getSpec(size_t index) const;
+            ChannelId getChannel(size_t index) const;
+
+            /// @brief 배치에 필터 출력 열을 채움 (디바이스별 상태 유지)
+            void process(SensorBatch& batch);
+
+            /// @brief 모든 디바이스의 필터 상태 초기화
+            void reset();
+
+            std::string getLastError() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
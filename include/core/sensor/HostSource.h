@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "core/sensor/SensorSource.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 호스트 소스 설정
+        struct HostSourceConfig {
+            float sample_rate_hz = 10.0f;
+            std::string hwmon_root = "/sys/class/hwmon";
+            std::string proc_root = "/proc";
+            std::string hwmon_name;             // hwmon 칩 이름 필터 (예: "coretemp", "cpu_thermal"). 비우면 전체
+        };
+
+        /// @brief 엔진이 도는 호스트 자신의 온도/CPU/메모리 소스 (Linux)
+        /// @details start()에서 hwmon temp*_input, /proc/stat, /proc/meminfo를 한 번 열어두고
+        ///          전용 스레드가 샘플링 주기마다 pread로 처음부터 다시 읽는다 (열기/닫기, 경로 탐색 없음).
+        ///          CPU 사용률은 이전 샘플과의 /proc/stat 누적 시간 차이로, 메모리 사용률은
+        ///          (MemTotal - MemAvailable) / MemTotal로, 온도는 선택된 hwmon 센서 중 최고값으로 낸다.
+        ///          호스트에 없는 채널 중 습도, 기압, 조도는 NaN이고, 모션은 SensorData가 bool이라 0이다.
+        ///          SoC 온도는 환경 센서 기본 범위(85 °C)를 쉽게 넘으므로 getValidationRules()로 넓은 범위를 준다.
+        ///          타임스탬프는 실제 측정 시각이므로 매니저 시계가 아닌 Time::defaultClock() 기준이다.
+        class HostSource : public SensorSource {
+        public:
+            explicit HostSource(const HostSourceConfig& config = HostSourceConfig());
+            ~HostSource() override;
+
+            const char* getType() const override;
+            bool start() override;
+            void stop() override;
+            bool isRunning() const override;
+            size_t read(SensorBatch& out, Time::Timestamp now) override;
+            std::string getStatus() const override;
+            std::vector<ValidationRule> getValidationRules() const override;
+
+            /// @brief 설정 교체 (다음 start()부터 적용)
+            void setConfig(const HostSourceConfig& config);
+            const HostSourceConfig& getConfig() const;
+
+            /// @brief 열려 있는 hwmon 온도 센서 수
+            size_t getTemperatureSensorCount() const;
+
+            /// @brief 마지막 start() 실패 사유
+            std::string getLastError() const override;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
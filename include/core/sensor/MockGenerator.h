@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 목 신호 모델
+        enum class SignalModel {
+            RANDOM_WALK,    // 평균 회귀 랜덤 워크 (온습도, 기압처럼 천천히 떠도는 값)
+            SINUSOID,       // 주기 신호 + 잡음 (일교차 등)
+            STEPS,          // 무작위 시각에 단계적으로 바뀌는 값 (조명, 부하)
+            EVENTS          // 포아송 발생 + 고정 지속 시간 0/1 (모션)
+        };
+
+        /// @brief 채널 하나의 신호 정의
+        struct SignalSpec {
+            ChannelId channel = 0;              // 기본 채널만 가능
+            SignalModel model = SignalModel::RANDOM_WALK;
+            float base = 0.0f;                  // 중심값
+            float amplitude = 0.0f;             // SINUSOID: 진폭, STEPS: 단계 범위(±), RANDOM_WALK: 초당 변동 σ
+            float period_s = 60.0f;             // SINUSOID: 주기, RANDOM_WALK: 평균 회귀 시간
+            float rate_hz = 0.0f;               // STEPS: 전환 빈도, EVENTS: 발생 빈도
+            float duration_s = 0.0f;            // EVENTS: 지속 시간
+            float noise = 0.0f;                 // 측정 잡음 σ
+            float min = -std::numeric_limits<float>::infinity();
+            float max = std::numeric_limits<float>::infinity();
+        };
+
+        /// @brief 기본 채널의 기본 신호 (실내 환경 + 보통 부하의 PC)
+        std::vector<SignalSpec> defaultMockSignals();
+
+        /// @brief 목 생성기 설정
+        struct MockConfig {
+            uint64_t seed = 1;
+            float sample_rate_hz = 10.0f;
+            std::vector<SignalSpec> signals = defaultMockSignals();
+        };
+
+        /// @brief 결정적 배치 목 데이터 생성기
+        /// @details 난수는 (시드, 디바이스, 채널, 샘플 번호)를 해시하는 카운터 기반 생성기에서 뽑으므로
+        ///          같은 시드면 몇 개씩 나눠 생성하든 같은 값이 나온다. 난수 열을 먼저 연속 버퍼에
+        ///          채우고(샘플 간 의존이 없어 벡터화 가능) 신호 모델의 상태 갱신만 순차로 돈다.
+        ///          출력은 SensorBatch의 채널 열에 바로 쓴다.
+        class MockGenerator {
+        public:
+            explicit MockGenerator(const MockConfig& config = MockConfig());
+            ~MockGenerator();
+
+            MockGenerator(const MockGenerator&) = delete;
+            MockGenerator& operator=(const MockGenerator&) = delete;
+            MockGenerator(MockGenerator&&) noexcept;
+            MockGenerator& operator=(MockGenerator&&) noexcept;
+
+            /// @brief 디바이스의 다음 count개 샘플을 배치 끝에 추가
+            /// @param start_ns 첫 샘플 시각 (이후 샘플은 샘플링 주기 간격)
+            void generate(SensorBatch& out, uint32_t device_id, Time::Timestamp start_ns, size_t count);
+
+            /// @brief 설정 교체 (모든 디바이스 상태 초기화)
+            void setConfig(const MockConfig& config);
+            const MockConfig& getConfig() const;
+
+            /// @brief 샘플링 주기 (나노초)
+            Time::Timestamp getInterval() const;
+
+            /// @brief 디바이스 상태 초기화 (처음부터 같은 값이 다시 나옴)
+            void reset();
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
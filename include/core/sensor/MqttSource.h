@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorSource.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 토픽 -> 디바이스/채널 경로
+        struct MqttRoute {
+            std::string topic;              // 구독 필터. '+'는 한 단계 와일드카드 ('#'은 지원하지 않음)
+            ChannelId channel = 0;          // 페이로드 숫자 하나가 들어갈 채널 (kSensorChannelCount + kMaxExtendedChannels 미만)
+            uint32_t device_id = 0;         // 고정 디바이스 ID
+            int device_level = -1;          // 0 이상이면 이 단계의 토픽 세그먼트(10진수)를 디바이스 ID로 사용
+        };
+
+        /// @brief MQTT 소스 설정
+        struct MqttSourceConfig {
+            std::string host = "127.0.0.1";
+            int port = 1883;
+            std::string client_id = "dachshund-engine";
+            std::string username;           // 비우면 인증 없음
+            std::string password;
+            uint16_t keep_alive_s = 30;
+            uint8_t qos = 0;                // 구독 QoS (0 또는 1)
+            Time::Timestamp reconnect_ns = 2 * Time::kNanosPerSecond;
+            size_t max_packet_bytes = 64 * 1024;
+            std::vector<MqttRoute> routes;
+        };
+
+        /// @brief MQTT 소스 통계
+        struct MqttCounters {
+            uint64_t messages = 0;          // 경로에 맞아 샘플이 된 PUBLISH
+            uint64_t unrouted = 0;          // 맞는 경로가 없는 PUBLISH
+            uint64_t bad_payloads = 0;      // 숫자가 아닌 페이로드
+            uint64_t bytes = 0;
+            uint64_t connects = 0;
+        };
+
+        /// @brief MQTT 3.1.1 브로커를 구독해 여러 디바이스의 샘플을 내는 소스 (POSIX)
+        /// @details 별도 스레드 없이 매니저 수집 주기마다 논블로킹 소켓을 처리한다 (연결, CONNECT/SUBSCRIBE,
+        ///          PUBLISH 수신, QoS 1 PUBACK, keep-alive PINGREQ, 끊기면 reconnect_ns 뒤 재연결).
+        ///          경로는 start() 때 미리 컴파일된다: 와일드카드 없는 토픽은 해시 표, '+' 토픽은 세그먼트 목록.
+        ///          채널이 범위를 넘거나 같은 토픽이 두 번 나오는 경로는 start()가 실패한다 (getLastError()).
+        ///          PUBLISH는 수신 버퍼 안에서 바로 해석하며 (토픽은 string_view, 값은 from_chars)
+        ///          메시지마다 할당하지 않는다. 메시지 하나가 샘플 한 줄이 되고, 다른 채널은 그 디바이스에서
+        ///          마지막으로 받은 값을 유지한다 (받은 적 없으면 NaN). 타임스탬프는 직전 수집 이후 구간에 고르게 붙인다.
+        class MqttSource : public SensorSource {
+        public:
+            explicit MqttSource(const MqttSourceConfig& config = MqttSourceConfig());
+            ~MqttSource() override;
+
+            const char* getType() const override;
+            bool start() override;          // 경로 컴파일 후 연결 시작 (연결은 이후 수집 주기에서 진행)
+            void stop() override;
+            bool isRunning() const override;
+            /// @brief 네트워크 처리 후 이 소스 디바이스 ID의 샘플만 추가 (다른 디바이스 샘플은 버림. 매니저는 collect()를 씀)
+            size_t read(SensorBatch& out, Time::Timestamp now) override;
+            void collect(Time::Timestamp now, SensorBatch& scratch, const BatchSink& sink) override;
+            std::string getStatus() const override;
+
+            /// @brief 브로커와 세션이 맺어져 있으면 true
+            bool isConnected() const;
+
+            /// @brief 설정 교체 (다음 start()부터 적용)
+            void setConfig(const MqttSourceConfig& config);
+            const MqttSourceConfig& getConfig() const;
+
+            MqttCounters getCounters() const;
+            std::string getLastError() const override;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
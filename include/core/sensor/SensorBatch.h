@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "core/sensor/SensorManager.h"
+#include "core/time/Clock.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 채널 식별자 (기본 채널은 SensorChannel, 그 이후 번호는 확장 채널용)
+        using ChannelId = uint16_t;
+
+        /// @brief 기본 센서 채널 (SensorData 필드와 1:1 대응)
+        enum class SensorChannel : ChannelId {
+            TEMPERATURE,
+            HUMIDITY,
+            PRESSURE,
+            LIGHT,
+            MOTION,         // 0.0 / 1.0 으로 저장
+            CPU_USAGE,
+            MEMORY_USAGE,
+            COUNT
+        };
+
+        constexpr size_t kSensorChannelCount = static_cast<size_t>(SensorChannel::COUNT);
+
+        /// @brief 기본 채널 뒤에 등록할 수 있는 확장 채널(필터/파생 채널) 최대 개수
+        /// @details 이벤트 버스의 SampleEvent가 확장 채널 값을 고정 배열로 싣기 때문에 그 크기와 같다.
+        constexpr size_t kMaxExtendedChannels = 16;
+
+        constexpr ChannelId toChannelId(SensorChannel channel) {
+            return static_cast<ChannelId>(channel);
+        }
+
+        /// @brief 채널 이름 반환 (기본 채널이 아니면 "channel")
+        const char* channelName(ChannelId channel);
+
+        /// @brief 채널 값을 채우는 단계 (같은 이름을 두 단계가 함께 쓰지 못하게 하는 데 사용)
+        enum class ChannelOwner : uint8_t {
+            NONE,           // 정의가 제거되어 비어 있는 확장 채널
+            BASE,
+            FILTER,         // FilterBank 출력
+            DERIVED         // DerivedChannelSet 출력
+        };
+
+        const char* channelOwnerName(ChannelOwner owner);
+
+        /// @brief 채널 이름 <-> ID 등록부
+        /// @details 기본 채널이 먼저 등록되어 있고, 파생 채널 등 확장 채널은
+        ///          registerChannel로 뒤에 이어지는 ID를 받는다.
+        ///          채널마다 현재 값을 채우는 단계를 기록해 둔다 (제거되어도 ID는 남고 소유만 비워짐).
+        class ChannelRegistry {
+        public:
+            ChannelRegistry();
+
+            /// @brief 채널 등록 (이미 있는 이름이면 기존 ID 반환)
+            ChannelId registerChannel(const std::string& name);
+
+            /// @brief 이름으로 채널 찾기
+            /// @return 존재 여부
+            bool find(const std::string& name, ChannelId& out) const;
+
+            const std::string& getName(ChannelId channel) const;
+            size_t size() const { return names.size(); }
+
+            ChannelOwner getOwner(ChannelId channel) const;
+            void setOwner(ChannelId channel, ChannelOwner owner);
+
+            /// @brief 확장 채널이 kMaxExtendedChannels 개 모두 등록되어 새 이름을 받을 수 없으면 true
+            bool isFull() const { return names.size() >= kSensorChannelCount + kMaxExtendedChannels; }
+
+        private:
+            std::vector<std::string> names;
+            std::unordered_map<std::string, ChannelId> ids;
+            std::vector<ChannelOwner> owners;
+        };
+
+        /// @brief 한 디바이스에서 들어온 샘플 묶음 (열 지향 SoA 레이아웃)
+        /// @details 채널별 값이 연속된 float 배열로 저장되어 규칙 평가나
+        ///          통계 계산이 채널 단위로 한 번에 순회할 수 있다.
+        struct SensorBatch {
+            uint32_t device_id = 0;
+            std::vector<Time::Timestamp> timestamps_ns;  // 단조 증가 타임스탬프 (나노초)
+            std::vector<std::vector<float>> columns;     // columns[channel][sample]
+            std::vector<uint32_t> quality;               // [sample] 품질 비트 (DataValidator가 채움, 0이면 정상)
+
+            SensorBatch();
+
+            size_t size() const { return timestamps_ns.size(); }
+            bool empty() const { return timestamps_ns.empty(); }
+            size_t channelCount() const { return columns.size(); }
+
+            /// @brief 채널 열 접근
+            std::vector<float>& column(ChannelId channel) { return columns[channel]; }
+            const std::vector<float>& column(ChannelId channel) const { return columns[channel]; }
+            std::vector<float>& column(SensorChannel channel) { return columns[toChannelId(channel)]; }
+            const std::vector<float>& column(SensorChannel channel) const { return columns[toChannelId(channel)]; }
+
+            /// @brief 채널 수를 최소 count 개로 확장 (새 채널은 현재 샘플 수만큼 0으로 채움)
+            void ensureChannels(size_t count);
+
+            /// @brief SensorData 한 개를 배치 끝에 추가
+            void append(const SensorData& data, Time::Timestamp timestamp_ns);
+
+            /// @brief i번째 샘플을 SensorData로 복원
+            SensorData sampleAt(size_t index) const;
+
+            void reserve(size_t samples);
+            void clear();
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -1,18 +1,50 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "core/time/Clock.h"
 namespace DachshundEngine {
+    namespace Alert {
+        class AlertEngine;
+        struct AlertEvent;
+    }
+
+    namespace Event {
+        class EventBus;
+    }
+
+    namespace Ipc {
+        class SharedRingWriter;
+    }
+
     namespace Sensor {
+        class ChannelRegistry;
+        class CalibrationTable;
+        class DerivedChannelSet;
+        class FilterBank;
+        class DataValidator;
+        class MockGenerator;
+        class SensorSource;
+        struct SensorBatch;
+
+        /// @brief 매니저에 등록된 데이터 소스 식별자
+        using SourceId = uint32_t;
+
+        /// @brief 수집 배치 처리기 (파생 채널 계산, 규칙 평가 후 호출)
+        using BatchProcessor = std::function<void(const SensorBatch&)>;
 
         /// @brief 센서 연결 상태를 나타내는 구조체
         struct ConnectionStatus {
             bool is_connected = false;
-            float last_data_time = 0.0f;
+            Time::Timestamp last_data_time = 0;   // 마지막 데이터 수신 시각 (나노초)
             int reconnect_attempts = 0;
             std::string status_message = "Not Connected";
             
             // 연결 상태 업데이트 메서드
-            void updateStatus(bool connected, float current_time);
+            void updateStatus(bool connected, Time::Timestamp current_time);
             void incrementReconnectAttempts();
             void resetConnectionStatus();
         };
@@ -26,15 +58,16 @@ namespace DachshundEngine {
             bool motion_detected = false;
             float cpu_usage = 0.0f;
             float memory_usage = 0.0f;
-            bool data_valid = false;
+            bool data_valid = false;        // 수신/파싱 성공 여부
+            uint32_t quality = 0;           // 검증에서 문제가 발견된 채널 비트 (bit n = 채널 n, 0이면 정상)
             
-            // 데이터 검증 메서드
+            // 데이터 검증 메서드 (수신되었고 검증 문제도 없으면 true)
             bool isValid() const;
             void copyFrom(const SensorData& other);
             void resetSensorData();
         };
 
-        /// @brief 센서 데이터 관리 모드
+        /// @brief 센서 데이터 관리 모드 (최신 샘플을 제공할 내장 소스 선택)
         enum class SensorMode {
             MOCK_DATA,      // 목 데이터 생성
             RASPBERRY_PI,   // 라즈베리파이 실제 센서 데이터
@@ -60,15 +93,78 @@ namespace DachshundEngine {
                 void disconnect();
                 bool isConnected() const;
 
-                // 데이터 수신
+                // 데이터 수신 (수집 주기마다 갱신되는 최신 샘플. 샘플링 스레드가 없으면 호출 시 주기가 됐을 때만 수집)
                 SensorData getCurrentSensorData();
 
                 // 모드 변경
                 void setMode(SensorMode mode);
                 SensorMode getMode() const;
 
-                // 설정
+                // 설정: 수집 주기 (목 생성/네트워크 수신 처리와 파이프라인 실행 간격, 기본 100ms).
+                // 목 샘플 개수는 생성기 샘플링 주기로 정해지고, 수집 주기는 몇 개씩 묶어 처리할지만 정한다
                 void setUpdateInterval(float milliseconds);
+                float getUpdateInterval() const;
+
+                // 샘플링 스레드: 켜면 수집 주기마다 전용 스레드가 수집/파이프라인을 돌리고
+                // getCurrentSensorData()는 최신 샘플만 돌려준다 (UI 갱신 속도와 무관한 데이터 속도/CPU 사용).
+                // 스레드는 실시간으로 잠드므로 가상 시계로 재생할 때는 켜지 말고 직접 호출로 구동.
+                // stopSampling()은 스레드를 기다리므로 lockPipeline()을 쥔 채로 부르지 않는다
+                void startSampling();
+                void stopSampling();
+                bool isSampling() const;
+
+                // 파이프라인 잠금: 샘플링 스레드가 도는 동안 아래 getter로 얻은 모듈과 배치 처리기가
+                // 갱신하는 객체를 다른 스레드에서 읽고 쓸 때 잡는다 (재진입 가능, 매니저 메서드 호출 가능)
+                std::unique_lock<std::recursive_mutex> lockPipeline();
+
+                // 목 데이터 생성기 (MOCK_DATA 모드에서 샘플링 주기마다 신호 모델로 샘플 생성)
+                MockGenerator& getMockGenerator();
+
+                // 데이터 소스: 실행 중인 소스는 모두 수집 주기마다 배치로 읽혀 소스 디바이스 ID로
+                // 파이프라인에 들어간다. 내장 목/라즈베리파이 소스는 모드와 연결 함수가 켜고 끄며 제거할 수 없다.
+                // 같은 디바이스 ID의 소스를 동시에 실행하지 않는다 (디바이스별 필터/검증 상태가 섞임).
+                // start가 true인데 소스 시작에 실패하면 소스를 버리고 kInvalidSourceId를 돌려주며,
+                // 이유는 getLastSourceError()로 읽는다
+                static constexpr SourceId kMockSourceId = 0;
+                static constexpr SourceId kRaspberryPiSourceId = 1;
+                static constexpr SourceId kInvalidSourceId = 0xFFFFFFFF;
+                SourceId addSource(std::unique_ptr<SensorSource> source, bool start = true);
+                bool removeSource(SourceId id);
+                SensorSource* getSource(SourceId id);
+                std::vector<SourceId> getSourceIds() const;
+                std::string getLastSourceError() const;
+
+                // 보정표 (수집 직후, 파생 채널 계산 전에 배치 전체에 적용). 어느 스레드에서든
+                // 교체 가능하며 수집은 멈추지 않는다 (다음 배치부터 새 표 사용). nullptr이면 보정 끔
+                void setCalibration(std::shared_ptr<const CalibrationTable> table);
+                std::shared_ptr<const CalibrationTable> getCalibration() const;
+
+                // 데이터 품질 검증 (보정 직후 범위/고착/NaN 검사, 샘플별 품질 비트와 채널별 카운터)
+                DataValidator& getValidator();
+
+                // 채널 등록부, 평활 필터와 파생 채널 (수집 시 계산되어 기본 채널과 같이 저장/발행됨)
+                ChannelRegistry& getChannelRegistry();
+                FilterBank& getFilterBank();
+                DerivedChannelSet& getDerivedChannels();
+
+                // 알림 규칙 (수집된 모든 샘플에 대해 평가)
+                Alert::AlertEngine& getAlertEngine();
+                void setOnAlert(std::function<void(const Alert::AlertEvent&)> callback);
+
+                // 분석 모듈 연결: 수집된 배치 전체를 등록 순서대로 전달. 반환된 ID로 해제
+                size_t addBatchProcessor(BatchProcessor processor);
+                void removeBatchProcessor(size_t id);
+
+                // 시계 (기본값: Time::defaultClock). 가상 시계를 넣으면 결정적 테스트/고속 재생 가능
+                void setClock(std::shared_ptr<Time::Clock> clock);
+                Time::Clock& getClock() const;
+
+                // 이벤트 버스 연결 (샘플/알림/연결 상태 발행, 명령 구독). nullptr이면 해제
+                void attachEventBus(Event::EventBus* bus);
+
+                // 공유 메모리 링 연결 (수집된 모든 샘플을 배치 처리기 뒤에 기록, 채널 이름 표도 갱신).
+                // 열린 작성자를 넘기며 nullptr이면 해제. 작성자는 매니저보다 오래 살아야 한다
+                void attachSharedRing(Ipc::SharedRingWriter* ring);
             private:
                 class Impl;
                 std::unique_ptr<Impl> pImpl; // Pimpl 패턴으로 구현 숨기기
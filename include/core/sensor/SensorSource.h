@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+#include "core/sensor/Validation.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        class MockGenerator;
+
+        /// @brief 수집된 배치를 파이프라인으로 넘기는 함수 (배치는 호출 뒤 비워짐)
+        using BatchSink = std::function<void(SensorBatch&)>;
+
+        /// @brief 센서 데이터 소스 인터페이스 (목, 라즈베리파이, 재생, 공유 메모리 등)
+        /// @details 매니저는 수집 주기마다 실행 중인 모든 소스의 read()를 불러 그동안 쌓인 샘플을
+        ///          배치로 받아 소스별로 파이프라인에 넣는다. read()와 handleCommand()는 수집 스레드
+        ///          (파이프라인 잠금 아래)에서만 호출되므로, 자체 스레드로 받는 소스는 내부 버퍼만 보호하면 된다.
+        class SensorSource {
+        public:
+            virtual ~SensorSource() = default;
+
+            /// @brief 소스 종류 (레지스트리 등록 이름)
+            virtual const char* getType() const = 0;
+
+            virtual bool start() = 0;
+            virtual void stop() = 0;
+            virtual bool isRunning() const = 0;
+
+            /// @brief 마지막 호출 이후 쌓인 샘플을 배치 끝에 추가
+            /// @param now 수집 시각 (매니저 시계). 자체 타임스탬프가 없는 샘플에 사용
+            /// @return 추가한 샘플 수
+            virtual size_t read(SensorBatch& out, Time::Timestamp now) = 0;
+
+            /// @brief 수집 주기마다 매니저가 부르는 진입점. 기본은 read() 한 번으로 이 소스 디바이스의 배치 하나.
+            ///        여러 디바이스를 내는 소스(MQTT 브리지 등)는 재정의해 디바이스마다 scratch를 채워 sink를 부른다
+            virtual void collect(Time::Timestamp now, SensorBatch& scratch, const BatchSink& sink) {
+                scratch.device_id = device_id;
+                read(scratch, now);
+                sink(scratch);
+            }
+
+            /// @brief 이 소스의 디바이스로 온 명령 처리 (set_sampling_rate 등)
+            /// @return 처리했으면 true
+            virtual bool handleCommand(const char* command, float value) {
+                (void)command;
+                (void)value;
+                return false;
+            }
+
+            /// @brief 상태 한 줄 요약 (UI 표시용)
+            virtual std::string getStatus() const {
+                return isRunning() ? "running" : "stopped";
+            }
+
+            /// @brief 마지막 실패 이유 (start() 실패 등, 없으면 빈 문자열)
+            virtual std::string getLastError() const {
+                return std::string();
+            }
+
+            /// @brief 이 소스 디바이스에만 쓸 검증 규칙 (기본 규칙과 범위가 다른 채널만, addSource에서 등록)
+            virtual std::vector<ValidationRule> getValidationRules() const {
+                return {};
+            }
+
+            uint32_t getDeviceId() const { return device_id; }
+            void setDeviceId(uint32_t id) { device_id = id; }
+
+        protected:
+            uint32_t device_id = 0;
+        };
+
+        /// @brief 소스 생성 함수
+        using SourceFactory = std::function<std::unique_ptr<SensorSource>()>;
+
+        /// @brief 소스 종류 이름 -> 생성 함수 등록부
+        class SourceRegistry {
+        public:
+            SourceRegistry();
+            ~SourceRegistry();
+
+            SourceRegistry(const SourceRegistry&) = delete;
+            SourceRegistry& operator=(const SourceRegistry&) = delete;
+
+            /// @brief 종류 등록 (같은 이름이 이미 있으면 false)
+            bool registerType(const std::string& type, SourceFactory factory);
+
+            /// @brief 소스 생성 (모르는 종류면 nullptr)
+            std::unique_ptr<SensorSource> create(const std::string& type) const;
+
+            /// @brief 등록된 종류 이름 (등록 순서)
+            std::vector<std::string> getTypes() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+        /// @brief 프로세스 전역 등록부 ("mock", "raspberry_pi", "host", "serial", "mqtt" 기본 등록)
+        SourceRegistry& sourceRegistry();
+
+        /// @brief MockGenerator로 시계를 따라 샘플을 만드는 소스
+        /// @details read() 시점까지 밀린 샘플을 생성기 샘플링 주기 간격으로 한 번에 만든다.
+        ///          오래 멈췄다 돌아오면 최근 max_backlog 분량만 만든다.
+        class MockSource : public SensorSource {
+        public:
+            MockSource();
+            ~MockSource() override;
+
+            const char* getType() const override;
+            bool start() override;
+            void stop() override;
+            bool isRunning() const override;
+            size_t read(SensorBatch& out, Time::Timestamp now) override;
+
+            MockGenerator& getGenerator();
+
+            /// @brief 한 번에 따라잡을 최대 구간 (기본 1초)
+            void setMaxBacklog(Time::Timestamp backlog_ns);
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/sensor/SensorSource.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 시리얼 프레임 형식
+        enum class SerialFraming {
+            LINE,       // 텍스트 한 줄 = 샘플 하나: "23.5,45.1,1013.2\n" ('#'으로 시작하는 줄은 무시)
+            BINARY      // [sync0 sync1][n][float32 LE × n][CRC-8] (CRC는 n과 페이로드에 대해, 다항식 0x07)
+        };
+
+        /// @brief 프레임 디코더 설정
+        struct SerialFramingConfig {
+            SerialFraming framing = SerialFraming::LINE;
+            char delimiter = ',';                       // LINE: 필드 구분자 (공백도 항상 구분자로 취급)
+            uint8_t sync[2] = { 0xAA, 0x55 };           // BINARY: 프레임 시작 바이트
+            size_t max_frame_bytes = 512;               // 이보다 긴 줄/프레임은 버림
+            /// 필드 순서 -> 채널 (기본: 온도, 습도, 기압, 조도, 모션, CPU, 메모리)
+            std::vector<ChannelId> fields = {
+                toChannelId(SensorChannel::TEMPERATURE), toChannelId(SensorChannel::HUMIDITY),
+                toChannelId(SensorChannel::PRESSURE), toChannelId(SensorChannel::LIGHT),
+                toChannelId(SensorChannel::MOTION), toChannelId(SensorChannel::CPU_USAGE),
+                toChannelId(SensorChannel::MEMORY_USAGE)
+            };
+        };
+
+        /// @brief 디코더 통계
+        struct SerialCounters {
+            uint64_t bytes = 0;
+            uint64_t frames = 0;
+            uint64_t bad_frames = 0;        // CRC 오류, 숫자 아닌 필드, 길이 초과
+        };
+
+        /// @brief 바이트 스트림 -> 샘플 값 디코더
+        /// @details 임의로 잘린 바이트 조각을 받아 완성된 프레임의 필드 값을 한 연속 버퍼에
+        ///          (프레임 × 필드 수) 모은다. 필드가 모자란 프레임은 남은 필드를 NaN으로 채운다.
+        ///          BINARY 모드는 CRC가 틀리면 sync 다음 바이트부터 다시 찾는다.
+        class SerialDecoder {
+        public:
+            explicit SerialDecoder(const SerialFramingConfig& config = SerialFramingConfig());
+            ~SerialDecoder();
+
+            SerialDecoder(SerialDecoder&&) noexcept;
+            SerialDecoder& operator=(SerialDecoder&&) noexcept;
+
+            /// @brief 받은 바이트 추가 (완성된 프레임은 값 버퍼에 쌓임)
+            void feed(const uint8_t* data, size_t size);
+
+            /// @brief 쌓인 프레임 수
+            size_t frameCount() const;
+
+            /// @brief 쌓인 값 [frame * fields.size() + field]
+            const std::vector<float>& values() const;
+
+            /// @brief 쌓인 프레임을 배치 끝에 추가하고 비움
+            /// @details 타임스탬프는 from_ns 초과 to_ns 이하 구간에 고르게 나눠 단조 증가하게 붙인다.
+            ///          매핑되지 않은 채널은 NaN
+            /// @return 추가한 샘플 수
+            size_t drain(SensorBatch& out, Time::Timestamp from_ns, Time::Timestamp to_ns);
+
+            /// @brief 부분 프레임과 쌓인 값 버림 (통계는 유지)
+            void reset();
+
+            const SerialFramingConfig& getConfig() const;
+            SerialCounters getCounters() const;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+        /// @brief 시리얼 소스 설정
+        struct SerialSourceConfig {
+            std::string device = "/dev/ttyUSB0";
+            int baud = 115200;
+            SerialFramingConfig framing;
+        };
+
+        /// @brief termios 기반 UART 소스 (POSIX)
+        /// @details 포트를 raw 8N1 논블로킹으로 열고, 매니저 수집 주기마다 read()에서 커널 버퍼에
+        ///          쌓인 바이트를 전부 읽어 디코더로 한 번에 풀고 배치로 넘긴다 (별도 스레드 없음).
+        ///          읽기 오류(장치 분리, 의사 터미널 반대편 닫힘)가 나면 포트를 닫고 멈춘다.
+        class SerialSource : public SensorSource {
+        public:
+            explicit SerialSource(const SerialSourceConfig& config = SerialSourceConfig());
+            ~SerialSource() override;
+
+            const char* getType() const override;
+            bool start() override;
+            void stop() override;
+            bool isRunning() const override;
+            size_t read(SensorBatch& out, Time::Timestamp now) override;
+            std::string getStatus() const override;
+
+            /// @brief 설정 교체 (다음 start()부터 적용)
+            void setConfig(const SerialSourceConfig& config);
+            const SerialSourceConfig& getConfig() const;
+
+            SerialCounters getCounters() const;
+            std::string getLastError() const override;
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief 채널 하나의 검증 규칙
+        struct ValidationRule {
+            ChannelId channel = 0;
+            float min = 0.0f;                   // 물리적으로 가능한 범위 [min, max]
+            float max = 0.0f;
+            Time::Timestamp stuck_ns = 0;       // 값이 이 시간 이상 그대로면 고착 (0이면 검사 안 함)
+            bool drop_out_of_range = true;      // 범위 밖 값을 NaN으로 바꿔 뒤 단계에서 결측으로 처리
+        };
+
+        /// @brief 채널별 누적 품질 카운터
+        struct QualityCounters {
+            uint64_t samples = 0;
+            uint64_t nan = 0;
+            uint64_t out_of_range = 0;
+            uint64_t stuck = 0;
+            uint64_t bad = 0;                   // 하나 이상 걸린 샘플 수
+        };
+
+        /// @brief 기본 채널의 기본 규칙 (센서 데이터시트 범위, 환경 센서는 10분 고착 검사)
+        std::vector<ValidationRule> defaultValidationRules();
+
+        /// @brief 수집 배치 품질 검증
+        /// @details 규칙이 있는 채널마다 열 하나를 분기 없이 한 번 훑으며 NaN, 범위 밖, 고착(마지막 변화
+        ///          이후 경과 시간)을 판정한다. 문제가 있는 샘플은 batch.quality[i]의 채널 비트가 켜지고
+        ///          (채널 31까지), 채널별 카운터가 늘어난다. 고착 판정은 배치 경계를 넘어 디바이스별로 이어진다.
+        ///          디바이스 규칙은 같은 채널의 기본 규칙을 그 디바이스에 한해 대신한다 (기본 규칙이 있는 채널만).
+        ///          내부 잠금이 있어 수집 스레드와 UI 스레드에서 함께 호출해도 된다.
+        class DataValidator {
+        public:
+            explicit DataValidator(const std::vector<ValidationRule>& rules = defaultValidationRules());
+            ~DataValidator();
+
+            DataValidator(const DataValidator&) = delete;
+            DataValidator& operator=(const DataValidator&) = delete;
+            DataValidator(DataValidator&&) noexcept;
+            DataValidator& operator=(DataValidator&&) noexcept;
+
+            /// @brief 규칙 추가/교체 (채널당 하나)
+            void setRule(const ValidationRule& rule);
+            bool removeRule(ChannelId channel);
+            std::vector<ValidationRule> getRules() const;
+
+            /// @brief 디바이스 한 대에만 쓸 규칙 (예: 호스트 SoC 온도는 환경 센서보다 범위가 넓음)
+            void setDeviceRule(uint32_t device_id, const ValidationRule& rule);
+            bool removeDeviceRule(uint32_t device_id, ChannelId channel);
+
+            /// @brief 배치 검증 (quality 비트를 채우고, 설정에 따라 범위 밖 값을 NaN으로 바꿈)
+            void process(SensorBatch& batch);
+
+            /// @brief 채널 카운터 (모든 디바이스 합계)
+            QualityCounters getCounters(ChannelId channel) const;
+            void resetCounters();
+
+        private:
+            class Impl;
+            std::unique_ptr<Impl> pImpl;
+        };
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace DachshundEngine {
+    namespace Time {
+
+        /// @brief 단조 증가 타임스탬프 (나노초). float 초와 달리 장시간 실행에도 정밀도가 유지된다.
+        using Timestamp = int64_t;
+
+        constexpr Timestamp kNanosPerMicro = 1000;
+        constexpr Timestamp kNanosPerMilli = 1000 * kNanosPerMicro;
+        constexpr Timestamp kNanosPerSecond = 1000 * kNanosPerMilli;
+
+        constexpr double toSeconds(Timestamp ns) {
+            return static_cast<double>(ns) / static_cast<double>(kNanosPerSecond);
+        }
+
+        constexpr double toMilliseconds(Timestamp ns) {
+            return static_cast<double>(ns) / static_cast<double>(kNanosPerMilli);
+        }
+
+        constexpr Timestamp fromSeconds(double seconds) {
+            return static_cast<Timestamp>(seconds * static_cast<double>(kNanosPerSecond));
+        }
+
+        constexpr Timestamp fromMilliseconds(double milliseconds) {
+            return static_cast<Timestamp>(milliseconds * static_cast<double>(kNanosPerMilli));
+        }
+
+        /// @brief 시계 인터페이스 (SensorCore 전체가 이 인터페이스로 시간을 얻는다)
+        class Clock {
+        public:
+            virtual ~Clock() = default;
+
+            /// @brief 현재 시각 (나노초, 단조 증가)
+            virtual Timestamp now() const = 0;
+        };
+
+        /// @brief std::chrono::steady_clock 기반 실시간 시계
+        class SteadyClock : public Clock {
+        public:
+            Timestamp now() const override;
+        };
+
+        /// @brief 수동으로 진행시키는 가상 시계
+        /// @details 결정적인 테스트나 실시간보다 빠른 재생에 사용한다.
+        ///          여러 스레드에서 읽어도 안전하며, 시간은 뒤로 가지 않는다.
+        class VirtualClock : public Clock {
+        public:
+            explicit VirtualClock(Timestamp start = 0) : current(start) {}
+
+            Timestamp now() const override {
+                return current.load(std::memory_order_acquire);
+            }
+
+            /// @brief 지정한 만큼 시간 진행
+            void advance(Timestamp delta);
+
+            /// @brief 지정한 시각으로 이동 (과거 시각이면 무시)
+            void set(Timestamp time);
+
+        private:
+            std::atomic<Timestamp> current;
+        };
+
+        /// @brief 프로세스 전역 기본 시계 (SteadyClock)
+        Clock& defaultClock();
+
+    } // namespace Time
+} // namespace DachshundEngine
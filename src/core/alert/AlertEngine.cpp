@@ -0,0 +1,223 @@
+#include "core/alert/AlertEngine.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Alert {
+
+        namespace {
+            /// @brief 디바이스 x 규칙 평가 상태
+            struct RuleState {
+                bool active = false;
+                uint32_t pending = 0;        // 연속으로 전이 조건을 만족한 샘플 수
+                Time::Timestamp pending_since = 0;  // 발생 조건을 처음 만족한 시각
+                bool has_prev = false;
+                float prev_value = 0.0f;
+                Time::Timestamp prev_time = 0;
+                AlertEvent raised;           // 마지막 발생 이벤트 (활성 알림 조회용)
+            };
+
+            /// @brief 평가용으로 정리된 규칙
+            struct CompiledRule {
+                AlertRule rule;
+                bool alive = true;
+                bool above = true;
+                float raise_level = 0.0f;    // 이 값을 넘으면 발생
+                float clear_level = 0.0f;    // 이 값을 넘어 돌아오면 해제
+                Time::Timestamp min_duration = 0;
+                uint32_t debounce = 1;
+            };
+        }
+
+        /// @brief AlertEngine 구현 클래스 (Pimpl 패턴)
+        class AlertEngine::Impl {
+        public:
+            std::vector<CompiledRule> rules;                        // RuleId == 인덱스
+            std::vector<std::vector<RuleId>> rules_by_channel;      // 채널별 규칙 색인
+            std::unordered_map<uint32_t, std::vector<RuleState>> device_states;
+            size_t alive_count = 0;
+
+            static CompiledRule compile(const AlertRule& rule) {
+                CompiledRule compiled;
+                compiled.rule = rule;
+                compiled.above = (rule.comparison == Comparison::ABOVE);
+                compiled.raise_level = rule.threshold;
+                compiled.clear_level = compiled.above ? rule.threshold - rule.hysteresis
+                                                      : rule.threshold + rule.hysteresis;
+                compiled.min_duration = (rule.type == RuleType::DURATION) ? rule.duration_ns : 0;
+                compiled.debounce = rule.debounce_samples > 0 ? rule.debounce_samples : 1;
+                return compiled;
+            }
+
+            std::vector<RuleState>& statesFor(uint32_t device_id) {
+                auto& states = device_states[device_id];
+                if (states.size() < rules.size()) {
+                    states.resize(rules.size());
+                }
+                return states;
+            }
+
+            /// @brief 한 규칙을 채널 열 전체에 대해 평가
+            static void evaluate(const CompiledRule& cr, RuleId id, RuleState& st,
+                                 uint32_t device_id, const float* values,
+                                 const Time::Timestamp* times, size_t count,
+                                 std::vector<AlertEvent>& out) {
+                const bool rate = (cr.rule.type == RuleType::RATE_OF_CHANGE);
+
+                for (size_t i = 0; i < count; ++i) {
+                    float metric = values[i];
+                    if (rate) {
+                        if (!st.has_prev || times[i] <= st.prev_time) {
+                            st.has_prev = true;
+                            st.prev_value = values[i];
+                            st.prev_time = times[i];
+                            continue;
+                        }
+                        double dt = Time::toSeconds(times[i] - st.prev_time);
+                        metric = static_cast<float>((values[i] - st.prev_value) / dt);
+                        st.prev_value = values[i];
+                        st.prev_time = times[i];
+                    }
+
+                    if (!st.active) {
+                        bool raise = cr.above ? (metric > cr.raise_level) : (metric < cr.raise_level);
+                        if (!raise) {
+                            st.pending = 0;
+                            continue;
+                        }
+                        if (st.pending == 0) {
+                            st.pending_since = times[i];
+                        }
+                        ++st.pending;
+                        if (st.pending >= cr.debounce && times[i] - st.pending_since >= cr.min_duration) {
+                            st.active = true;
+                            st.pending = 0;
+                            st.raised = AlertEvent{id, device_id, cr.rule.channel, AlertTransition::RAISED,
+                                                   cr.rule.severity, metric, times[i]};
+                            out.push_back(st.raised);
+                        }
+                    } else {
+                        bool clear = cr.above ? (metric < cr.clear_level) : (metric > cr.clear_level);
+                        if (!clear) {
+                            st.pending = 0;
+                            continue;
+                        }
+                        ++st.pending;
+                        if (st.pending >= cr.debounce) {
+                            st.active = false;
+                            st.pending = 0;
+                            out.push_back(AlertEvent{id, device_id, cr.rule.channel, AlertTransition::CLEARED,
+                                                     cr.rule.severity, metric, times[i]});
+                        }
+                    }
+                }
+            }
+        };
+
+        /// @brief AlertEngine 메서드 구현
+        AlertEngine::AlertEngine() : pImpl(std::make_unique<Impl>()) {}
+        AlertEngine::~AlertEngine() = default;
+        AlertEngine::AlertEngine(AlertEngine&&) noexcept = default;
+        AlertEngine& AlertEngine::operator=(AlertEngine&&) noexcept = default;
+
+        RuleId AlertEngine::addRule(const AlertRule& rule) {
+            RuleId id = static_cast<RuleId>(pImpl->rules.size());
+            pImpl->rules.push_back(Impl::compile(rule));
+
+            if (pImpl->rules_by_channel.size() <= rule.channel) {
+                pImpl->rules_by_channel.resize(rule.channel + 1);
+            }
+            pImpl->rules_by_channel[rule.channel].push_back(id);
+            pImpl->alive_count++;
+            return id;
+        }
+
+        bool AlertEngine::removeRule(RuleId id) {
+            if (id >= pImpl->rules.size() || !pImpl->rules[id].alive) {
+                return false;
+            }
+            pImpl->rules[id].alive = false;
+            auto& index = pImpl->rules_by_channel[pImpl->rules[id].rule.channel];
+            for (auto it = index.begin(); it != index.end(); ++it) {
+                if (*it == id) {
+                    index.erase(it);
+                    break;
+                }
+            }
+            for (auto& [device, states] : pImpl->device_states) {
+                if (id < states.size()) {
+                    states[id] = RuleState{};
+                }
+            }
+            pImpl->alive_count--;
+            return true;
+        }
+
+        void AlertEngine::clearRules() {
+            pImpl->rules.clear();
+            pImpl->rules_by_channel.clear();
+            pImpl->device_states.clear();
+            pImpl->alive_count = 0;
+        }
+
+        size_t AlertEngine::getRuleCount() const {
+            return pImpl->alive_count;
+        }
+
+        bool AlertEngine::getRule(RuleId id, AlertRule& out) const {
+            if (id >= pImpl->rules.size() || !pImpl->rules[id].alive) {
+                return false;
+            }
+            out = pImpl->rules[id].rule;
+            return true;
+        }
+
+        size_t AlertEngine::process(const Sensor::SensorBatch& batch, std::vector<AlertEvent>& out) {
+            if (batch.empty() || pImpl->alive_count == 0) {
+                return 0;
+            }
+
+            size_t before = out.size();
+            auto& states = pImpl->statesFor(batch.device_id);
+            size_t channels = std::min(batch.channelCount(), pImpl->rules_by_channel.size());
+
+            for (size_t ch = 0; ch < channels; ++ch) {
+                const auto& index = pImpl->rules_by_channel[ch];
+                if (index.empty()) {
+                    continue;
+                }
+                const float* values = batch.columns[ch].data();
+                for (RuleId id : index) {
+                    Impl::evaluate(pImpl->rules[id], id, states[id], batch.device_id,
+                                   values, batch.timestamps_ns.data(), batch.size(), out);
+                }
+            }
+            return out.size() - before;
+        }
+
+        bool AlertEngine::isActive(uint32_t device_id, RuleId id) const {
+            auto it = pImpl->device_states.find(device_id);
+            if (it == pImpl->device_states.end() || id >= it->second.size()) {
+                return false;
+            }
+            return it->second[id].active;
+        }
+
+        std::vector<AlertEvent> AlertEngine::getActiveAlerts() const {
+            std::vector<AlertEvent> active;
+            for (const auto& [device, states] : pImpl->device_states) {
+                for (size_t id = 0; id < states.size(); ++id) {
+                    if (states[id].active && pImpl->rules[id].alive) {
+                        active.push_back(states[id].raised);
+                    }
+                }
+            }
+            return active;
+        }
+
+        void AlertEngine::resetState() {
+            pImpl->device_states.clear();
+        }
+
+    } // namespace Alert
+} // namespace DachshundEngine
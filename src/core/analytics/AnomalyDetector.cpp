@@ -0,0 +1,219 @@
+#include "core/analytics/AnomalyDetector.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr float kMadToSigma = 0.6745f;   // 정규분포에서 MAD = 0.6745 sigma
+            constexpr float kMinSpread = 1e-6f;      // 설정 하한이 모두 0이고 기준값도 0일 때 0으로 나누지 않도록
+        }
+
+        /// @brief AnomalyDetector 구현 클래스 (Pimpl 패턴)
+        class AnomalyDetector::Impl {
+        public:
+            /// @brief 디바이스 하나의 스트림 상태 (채널 축 SoA)
+            struct DeviceState {
+                std::vector<Sensor::ChannelId> channels;
+                std::vector<float> mean, var;
+                std::vector<float> median, mad;
+                std::vector<uint32_t> count, cooldown;
+
+                std::vector<float> window;   // [채널][robust_window] 최근 값 (NaN은 결측)
+                size_t window_head = 0;
+                size_t since_refresh = 0;
+
+                // 샘플 하나 분량의 작업 버퍼
+                std::vector<float> x, ewma_z, robust_z;
+
+                void resize(size_t n, size_t robust_window) {
+                    mean.resize(n, 0.0f);
+                    var.resize(n, 0.0f);
+                    median.resize(n, 0.0f);
+                    mad.resize(n, 0.0f);
+                    count.resize(n, 0);
+                    cooldown.resize(n, 0);
+                    window.resize(n * robust_window, std::nanf(""));
+                    x.resize(n);
+                    ewma_z.resize(n);
+                    robust_z.resize(n);
+                }
+            };
+
+            AnomalyConfig config;
+            std::unordered_map<uint32_t, DeviceState> devices;
+            std::vector<float> sort_buffer;
+            uint64_t anomaly_count = 0;
+
+            explicit Impl(const AnomalyConfig& cfg) : config(cfg) {
+                config.alpha = std::clamp(config.alpha, 1e-4f, 1.0f);
+                config.robust_window = std::max<uint32_t>(config.robust_window, 3);
+                config.robust_refresh = std::max<uint32_t>(config.robust_refresh, 1);
+                config.min_spread = std::max(config.min_spread, kMinSpread);
+                config.relative_min_spread = std::max(config.relative_min_spread, 0.0f);
+                sort_buffer.reserve(config.robust_window);
+            }
+
+            /// @brief 배치의 채널 구성에 맞춰 추적 채널 목록 갱신 (새 채널은 뒤에 추가)
+            void syncChannels(DeviceState& state, const Sensor::SensorBatch& batch) {
+                if (config.channels.empty()) {
+                    for (size_t ch = state.channels.size(); ch < batch.channelCount(); ++ch) {
+                        state.channels.push_back(static_cast<Sensor::ChannelId>(ch));
+                    }
+                } else if (state.channels.empty()) {
+                    state.channels = config.channels;
+                }
+                state.resize(state.channels.size(), config.robust_window);
+            }
+
+            void refreshRobust(DeviceState& state) {
+                const size_t w = config.robust_window;
+                for (size_t j = 0; j < state.channels.size(); ++j) {
+                    const float* values = state.window.data() + j * w;
+                    sort_buffer.clear();
+                    for (size_t k = 0; k < w; ++k) {
+                        if (!std::isnan(values[k])) {
+                            sort_buffer.push_back(values[k]);
+                        }
+                    }
+                    if (sort_buffer.empty()) {
+                        continue;
+                    }
+                    auto mid = sort_buffer.begin() + sort_buffer.size() / 2;
+                    std::nth_element(sort_buffer.begin(), mid, sort_buffer.end());
+                    const float med = *mid;
+                    for (float& v : sort_buffer) {
+                        v = std::fabs(v - med);
+                    }
+                    std::nth_element(sort_buffer.begin(), mid, sort_buffer.end());
+                    state.median[j] = med;
+                    state.mad[j] = *mid;
+                }
+            }
+
+            size_t processDevice(DeviceState& state, const Sensor::SensorBatch& batch, std::vector<AnomalyEvent>& out) {
+                const size_t n = state.channels.size();
+                const size_t w = config.robust_window;
+                const float alpha = config.alpha;
+                const float threshold = config.threshold;
+                const float min_spread = config.min_spread;
+                const float relative = config.relative_min_spread;
+                size_t emitted = 0;
+
+                float* x = state.x.data();
+                float* mean = state.mean.data();
+                float* var = state.var.data();
+                float* ez = state.ewma_z.data();
+                float* rz = state.robust_z.data();
+                const float* median = state.median.data();
+                const float* mad = state.mad.data();
+
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    for (size_t j = 0; j < n; ++j) {
+                        Sensor::ChannelId ch = state.channels[j];
+                        x[j] = ch < batch.channelCount() ? batch.columns[ch][i] : std::nanf("");
+                    }
+
+                    // EWMA 커널: 채널 축으로 독립 (점수 계산 후 잘린 값으로 평균/분산 갱신)
+                    for (size_t j = 0; j < n; ++j) {
+                        const bool valid = !std::isnan(x[j]);
+                        const bool warm = state.count[j] >= config.warmup_samples;
+                        const float sd = std::max(std::sqrt(var[j]), std::max(min_spread, relative * std::fabs(mean[j])));
+                        const float d = valid ? x[j] - mean[j] : 0.0f;
+                        ez[j] = d / sd;
+                        // 중앙값/MAD는 이 채널 값이 들어간 뒤 한 번 이상 갱신되어야 유효.
+                        // MAD가 0이면(창 절반 이상이 같은 값) 견고 z는 의미가 없으므로 EWMA z에 맡긴다
+                        const bool robust = valid && state.count[j] >= config.robust_refresh && mad[j] > 0.0f;
+                        const float spread = std::max(mad[j], std::max(min_spread, relative * std::fabs(median[j])));
+                        rz[j] = robust ? kMadToSigma * (x[j] - median[j]) / spread : 0.0f;
+
+                        const float limit = threshold * sd;
+                        const float clipped = warm ? std::clamp(d, -limit, limit) : d;
+                        // 첫 샘플은 평균을 그 값으로 초기화, 결측은 상태 유지
+                        const float a = !valid ? 0.0f : (state.count[j] == 0 ? 1.0f : alpha);
+                        mean[j] += a * clipped;
+                        var[j] = (1.0f - a) * (var[j] + a * clipped * clipped);
+                    }
+
+                    // 판정과 이벤트 생성 (스칼라)
+                    for (size_t j = 0; j < n; ++j) {
+                        if (std::isnan(x[j])) {
+                            continue;
+                        }
+                        const bool warm = state.count[j] >= config.warmup_samples;
+                        state.count[j]++;
+                        if (state.cooldown[j] > 0) {
+                            state.cooldown[j]--;
+                        }
+                        const float score = std::max(std::fabs(ez[j]), std::fabs(rz[j]));
+                        if (!warm || score <= threshold || state.cooldown[j] > 0) {
+                            continue;
+                        }
+                        AnomalyEvent event;
+                        event.device_id = batch.device_id;
+                        event.channel = state.channels[j];
+                        event.value = x[j];
+                        event.score = score;
+                        event.ewma_z = ez[j];
+                        event.robust_z = rz[j];
+                        event.timestamp_ns = batch.timestamps_ns[i];
+                        out.push_back(event);
+                        state.cooldown[j] = config.cooldown_samples;
+                        ++emitted;
+                    }
+
+                    for (size_t j = 0; j < n; ++j) {
+                        state.window[j * w + state.window_head] = x[j];
+                    }
+                    state.window_head = (state.window_head + 1) % w;
+                    if (++state.since_refresh >= config.robust_refresh) {
+                        state.since_refresh = 0;
+                        refreshRobust(state);
+                    }
+                }
+                return emitted;
+            }
+        };
+
+        /// @brief AnomalyDetector 메서드 구현
+        AnomalyDetector::AnomalyDetector(const AnomalyConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        AnomalyDetector::~AnomalyDetector() = default;
+        AnomalyDetector::AnomalyDetector(AnomalyDetector&&) noexcept = default;
+        AnomalyDetector& AnomalyDetector::operator=(AnomalyDetector&&) noexcept = default;
+
+        size_t AnomalyDetector::process(const Sensor::SensorBatch& batch, std::vector<AnomalyEvent>& out) {
+            if (batch.empty()) {
+                return 0;
+            }
+            Impl::DeviceState& state = pImpl->devices[batch.device_id];
+            pImpl->syncChannels(state, batch);
+            size_t emitted = pImpl->processDevice(state, batch, out);
+            pImpl->anomaly_count += emitted;
+            return emitted;
+        }
+
+        size_t AnomalyDetector::getStreamCount() const {
+            size_t streams = 0;
+            for (const auto& entry : pImpl->devices) {
+                streams += entry.second.channels.size();
+            }
+            return streams;
+        }
+
+        uint64_t AnomalyDetector::getAnomalyCount() const {
+            return pImpl->anomaly_count;
+        }
+
+        void AnomalyDetector::reset() {
+            pImpl->devices.clear();
+            pImpl->anomaly_count = 0;
+        }
+
+        const AnomalyConfig& AnomalyDetector::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,206 @@
+#include "core/analytics/CorrelationMatrix.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr size_t kResyncWindows = 16;
+        }
+
+        /// @brief CorrelationMatrix 구현 클래스 (Pimpl 패턴)
+        class CorrelationMatrix::Impl {
+        public:
+            std::vector<CorrelationInput> inputs;
+            size_t variables;
+            size_t window;
+
+            // 창 (기준점을 뺀 값) [slot][variable]
+            std::vector<double> ring;
+            size_t head = 0;
+            size_t filled = 0;
+            size_t since_resync = 0;
+
+            bool has_shift = false;
+            std::vector<double> shift;   // 기준점 (첫 프레임)
+            std::vector<double> sum;     // [variable]
+            std::vector<double> cross;   // [i][j], j >= i만 사용
+            std::vector<float> frame;    // 입력 변환용 작업 버퍼
+
+            mutable std::mutex mutex;
+
+            Impl(std::vector<CorrelationInput> in, size_t w)
+                : inputs(std::move(in)), variables(inputs.size()), window(std::max<size_t>(w, 2)) {
+                ring.assign(window * variables, 0.0);
+                shift.assign(variables, 0.0);
+                sum.assign(variables, 0.0);
+                cross.assign(variables * variables, 0.0);
+                frame.resize(variables);
+            }
+
+            void pushFrame(const float* values) {
+                for (size_t i = 0; i < variables; ++i) {
+                    if (std::isnan(values[i])) {
+                        return;
+                    }
+                }
+                if (!has_shift) {
+                    for (size_t i = 0; i < variables; ++i) {
+                        shift[i] = values[i];
+                    }
+                    has_shift = true;
+                }
+
+                double* slot = ring.data() + head * variables;
+                const bool evict = filled == window;
+                const size_t n = variables;
+
+                // 나가는 프레임 빼고 들어오는 프레임 더하기: 행 i마다 j 축으로 연속 접근
+                for (size_t i = 0; i < n; ++i) {
+                    const double in_i = values[i] - shift[i];
+                    const double out_i = evict ? slot[i] : 0.0;
+                    double* row = cross.data() + i * n;
+                    for (size_t j = i; j < n; ++j) {
+                        const double in_j = values[j] - shift[j];
+                        const double out_j = evict ? slot[j] : 0.0;
+                        row[j] += in_i * in_j - out_i * out_j;
+                    }
+                    sum[i] += in_i - out_i;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    slot[i] = values[i] - shift[i];
+                }
+
+                head = (head + 1) % window;
+                if (!evict) {
+                    ++filled;
+                }
+                if (++since_resync >= window * kResyncWindows) {
+                    resync();
+                }
+            }
+
+            /// @brief 창 전체에서 합계 재계산 (누적 오차 제거)
+            void resync() {
+                std::fill(sum.begin(), sum.end(), 0.0);
+                std::fill(cross.begin(), cross.end(), 0.0);
+                const size_t n = variables;
+                for (size_t s = 0; s < filled; ++s) {
+                    const double* x = ring.data() + s * n;
+                    for (size_t i = 0; i < n; ++i) {
+                        double* row = cross.data() + i * n;
+                        for (size_t j = i; j < n; ++j) {
+                            row[j] += x[i] * x[j];
+                        }
+                        sum[i] += x[i];
+                    }
+                }
+                since_resync = 0;
+            }
+
+            bool covariance(std::vector<float>& out) const {
+                const size_t n = variables;
+                out.assign(n * n, std::nanf(""));
+                if (filled < 2) {
+                    return false;
+                }
+                const double count = static_cast<double>(filled);
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t j = i; j < n; ++j) {
+                        double c = (cross[i * n + j] - sum[i] * sum[j] / count) / (count - 1.0);
+                        out[i * n + j] = out[j * n + i] = static_cast<float>(c);
+                    }
+                }
+                return true;
+            }
+        };
+
+        /// @brief CorrelationMatrix 메서드 구현
+        CorrelationMatrix::CorrelationMatrix(std::vector<CorrelationInput> inputs, size_t window)
+            : pImpl(std::make_unique<Impl>(std::move(inputs), window)) {}
+        CorrelationMatrix::~CorrelationMatrix() = default;
+        CorrelationMatrix::CorrelationMatrix(CorrelationMatrix&&) noexcept = default;
+        CorrelationMatrix& CorrelationMatrix::operator=(CorrelationMatrix&&) noexcept = default;
+
+        void CorrelationMatrix::push(const float* frame) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->pushFrame(frame);
+        }
+
+        void CorrelationMatrix::process(const Sensor::SensorBatch& batch) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const auto& inputs = pImpl->inputs;
+            float* frame = pImpl->frame.data();
+            for (size_t s = 0; s < batch.size(); ++s) {
+                for (size_t i = 0; i < inputs.size(); ++i) {
+                    frame[i] = inputs[i].channel < batch.channelCount() ? batch.columns[inputs[i].channel][s] : std::nanf("");
+                }
+                pImpl->pushFrame(frame);
+            }
+        }
+
+        void CorrelationMatrix::process(const AlignedBatch& batch) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const auto& inputs = pImpl->inputs;
+            float* frame = pImpl->frame.data();
+            for (size_t f = 0; f < batch.size(); ++f) {
+                for (size_t i = 0; i < inputs.size(); ++i) {
+                    const bool valid = inputs[i].stream < batch.stream_count && inputs[i].channel < batch.channel_count;
+                    frame[i] = valid ? batch.value(f, inputs[i].stream, inputs[i].channel) : std::nanf("");
+                }
+                pImpl->pushFrame(frame);
+            }
+        }
+
+        bool CorrelationMatrix::getCovariance(std::vector<float>& out) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return pImpl->covariance(out);
+        }
+
+        bool CorrelationMatrix::getCorrelation(std::vector<float>& out) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            if (!pImpl->covariance(out)) {
+                return false;
+            }
+            const size_t n = pImpl->variables;
+            std::vector<float> stddev(n);
+            for (size_t i = 0; i < n; ++i) {
+                float variance = out[i * n + i];
+                stddev[i] = variance > 0.0f ? std::sqrt(variance) : std::nanf("");
+            }
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    float r = out[i * n + j] / (stddev[i] * stddev[j]);
+                    out[i * n + j] = std::isnan(r) ? r : std::clamp(r, -1.0f, 1.0f);
+                }
+            }
+            return true;
+        }
+
+        size_t CorrelationMatrix::getVariableCount() const {
+            return pImpl->variables;
+        }
+
+        size_t CorrelationMatrix::getFrameCount() const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return pImpl->filled;
+        }
+
+        const std::vector<CorrelationInput>& CorrelationMatrix::getInputs() const {
+            return pImpl->inputs;
+        }
+
+        void CorrelationMatrix::reset() {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->head = 0;
+            pImpl->filled = 0;
+            pImpl->since_resync = 0;
+            pImpl->has_shift = false;
+            std::fill(pImpl->sum.begin(), pImpl->sum.end(), 0.0);
+            std::fill(pImpl->cross.begin(), pImpl->cross.end(), 0.0);
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,187 @@
+#include "core/analytics/EdgeLog.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            uint64_t streamKey(uint32_t device_id, Sensor::ChannelId channel) {
+                return (static_cast<uint64_t>(device_id) << 16) | channel;
+            }
+        }
+
+        /// @brief EdgeLog 구현 클래스 (Pimpl 패턴)
+        class EdgeLog::Impl {
+        public:
+            /// @brief 스트림 하나: 시작 상태 + 전이 시각
+            struct Stream {
+                Time::Timestamp origin = 0;        // 첫 관측 (또는 버려진 전이 이후) 시각
+                bool origin_state = false;
+                std::deque<Time::Timestamp> edges;
+                bool state = false;                // 현재 상태
+                Time::Timestamp last_seen = 0;     // 마지막 샘플 시각 (이후는 미관측)
+
+                /// @brief 시각 t까지(t 포함) 일어난 전이 수
+                size_t edgesUpTo(Time::Timestamp t) const {
+                    return static_cast<size_t>(std::upper_bound(edges.begin(), edges.end(), t) - edges.begin());
+                }
+
+                bool stateAfter(size_t edge_count) const {
+                    return origin_state != (edge_count % 2 == 1);
+                }
+            };
+
+            EdgeLogConfig config;
+            std::unordered_map<uint64_t, Stream> streams;
+            mutable std::mutex mutex;
+
+            explicit Impl(const EdgeLogConfig& cfg) : config(cfg) {
+                config.max_edges = std::max<size_t>(config.max_edges, 2);
+            }
+
+            const Stream* find(uint32_t device_id, Sensor::ChannelId channel) const {
+                auto it = streams.find(streamKey(device_id, channel));
+                return it != streams.end() ? &it->second : nullptr;
+            }
+
+            void append(Stream& s, const std::vector<float>& column, const std::vector<Time::Timestamp>& timestamps,
+                        bool first_sample) {
+                for (size_t i = 0; i < column.size(); ++i) {
+                    if (std::isnan(column[i])) {
+                        continue;
+                    }
+                    const bool value = column[i] >= config.threshold;
+                    const Time::Timestamp t = timestamps[i];
+                    if (first_sample) {
+                        s.origin = t;
+                        s.origin_state = value;
+                        s.state = value;
+                        first_sample = false;
+                    } else if (value != s.state) {
+                        s.edges.push_back(t);
+                        s.state = value;
+                        if (s.edges.size() > config.max_edges) {
+                            // 가장 오래된 전이를 버리면 그 시각부터가 새 시작점
+                            s.origin = s.edges.front();
+                            s.origin_state = !s.origin_state;
+                            s.edges.pop_front();
+                        }
+                    }
+                    s.last_seen = std::max(s.last_seen, t);
+                }
+            }
+        };
+
+        /// @brief EdgeLog 메서드 구현
+        EdgeLog::EdgeLog(const EdgeLogConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        EdgeLog::~EdgeLog() = default;
+        EdgeLog::EdgeLog(EdgeLog&&) noexcept = default;
+        EdgeLog& EdgeLog::operator=(EdgeLog&&) noexcept = default;
+
+        void EdgeLog::process(const Sensor::SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            for (Sensor::ChannelId channel : pImpl->config.channels) {
+                if (channel >= batch.channelCount()) {
+                    continue;
+                }
+                auto key = streamKey(batch.device_id, channel);
+                auto it = pImpl->streams.find(key);
+                const bool first = it == pImpl->streams.end();
+                if (first) {
+                    it = pImpl->streams.emplace(key, Impl::Stream()).first;
+                }
+                pImpl->append(it->second, batch.column(channel), batch.timestamps_ns, first);
+            }
+        }
+
+        bool EdgeLog::query(uint32_t device_id, Sensor::ChannelId channel, Time::Timestamp from, Time::Timestamp to,
+                            EdgeStats& out) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::Stream* s = pImpl->find(device_id, channel);
+            out = EdgeStats();
+            if (!s) {
+                return false;
+            }
+            // 관측된 범위 [origin, last_seen]로 제한
+            const Time::Timestamp begin = std::max(from, s->origin);
+            const Time::Timestamp end = std::min(to, s->last_seen);
+
+            // 구간 끝 이전 마지막 전이와 그 시점 상태
+            const size_t before_end = s->edgesUpTo(std::max(end, begin));
+            out.state = s->stateAfter(before_end);
+            out.last_change = before_end > 0 ? s->edges[before_end - 1] : 0;
+            if (end <= begin) {
+                return false;
+            }
+
+            size_t index = s->edgesUpTo(begin);
+            bool state = s->stateAfter(index);
+            Time::Timestamp cursor = begin;
+            Time::Timestamp high = 0;
+            for (; index < s->edges.size() && s->edges[index] < end; ++index) {
+                const Time::Timestamp edge = s->edges[index];
+                if (state) {
+                    high += edge - cursor;
+                    out.falling_edges++;
+                } else {
+                    out.rising_edges++;
+                }
+                state = !state;
+                cursor = edge;
+            }
+            if (state) {
+                high += end - cursor;
+            }
+            out.observed_ns = end - begin;
+            out.duty_cycle = static_cast<double>(high) / static_cast<double>(out.observed_ns);
+            return true;
+        }
+
+        bool EdgeLog::stateAt(uint32_t device_id, Sensor::ChannelId channel, Time::Timestamp t, bool& state) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::Stream* s = pImpl->find(device_id, channel);
+            if (!s || t < s->origin) {
+                return false;
+            }
+            state = s->stateAfter(s->edgesUpTo(t));
+            return true;
+        }
+
+        size_t EdgeLog::getEdges(uint32_t device_id, Sensor::ChannelId channel, Time::Timestamp from, Time::Timestamp to,
+                                 std::vector<Time::Timestamp>& edges, bool& initial_state) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            edges.clear();
+            const Impl::Stream* s = pImpl->find(device_id, channel);
+            if (!s) {
+                return 0;
+            }
+            size_t index = s->edgesUpTo(from);
+            initial_state = s->stateAfter(index);
+            for (; index < s->edges.size() && s->edges[index] < to; ++index) {
+                edges.push_back(s->edges[index]);
+            }
+            return edges.size();
+        }
+
+        size_t EdgeLog::getStorageBytes() const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            size_t bytes = 0;
+            for (const auto& entry : pImpl->streams) {
+                bytes += sizeof(Impl::Stream) + entry.second.edges.size() * sizeof(Time::Timestamp);
+            }
+            return bytes;
+        }
+
+        const EdgeLogConfig& EdgeLog::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,306 @@
+#include "core/analytics/FleetAggregator.h"
+#include "core/analytics/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+            /// @brief 병렬 리덕션의 작업자별 부분 결과
+            struct Partial {
+                float min = std::numeric_limits<float>::infinity();
+                float max = -std::numeric_limits<float>::infinity();
+                double sum = 0.0;
+                size_t count = 0;
+                uint32_t min_device = 0;
+                uint32_t max_device = 0;
+                QuantileSketch sketch;
+
+                void merge(const Partial& other) {
+                    if (other.count == 0) {
+                        return;
+                    }
+                    if (other.min < min) {
+                        min = other.min;
+                        min_device = other.min_device;
+                    }
+                    if (other.max > max) {
+                        max = other.max;
+                        max_device = other.max_device;
+                    }
+                    sum += other.sum;
+                    count += other.count;
+                    sketch.merge(other.sketch);
+                }
+            };
+        }
+
+        /// @brief FleetAggregator 구현 클래스 (Pimpl 패턴)
+        class FleetAggregator::Impl {
+        public:
+            /// @brief 채널 하나의 증분 상태 (값 순 정렬 집합, 디바이스 슬롯 기준)
+            struct ChannelIndex {
+                std::set<std::pair<float, uint32_t>> ordered;
+                double sum = 0.0;
+            };
+
+            FleetConfig config;
+            std::vector<Sensor::ChannelId> channels;
+            std::unordered_map<uint32_t, uint32_t> device_slot;
+            std::vector<uint32_t> device_ids;                // [slot]
+            std::vector<Time::Timestamp> last_seen;          // [slot]
+            std::vector<uint8_t> indexed;                    // [slot] 증분 집합에 들어 있는지
+            std::vector<std::vector<float>> values;          // [channel][slot], 값이 없으면 NaN
+            std::vector<ChannelIndex> index;                 // [channel]
+            mutable std::mutex mutex;
+
+            explicit Impl(const FleetConfig& cfg) : config(cfg) {
+                config.smoothing = std::clamp(config.smoothing, 1e-3f, 1.0f);
+                config.parallel_threshold = std::max<size_t>(config.parallel_threshold, 1);
+                channels = config.channels;
+                if (channels.empty()) {
+                    for (size_t ch = 0; ch < Sensor::kSensorChannelCount; ++ch) {
+                        channels.push_back(static_cast<Sensor::ChannelId>(ch));
+                    }
+                }
+                values.resize(channels.size());
+                index.resize(channels.size());
+            }
+
+            uint32_t slotFor(uint32_t device_id) {
+                auto it = device_slot.find(device_id);
+                if (it != device_slot.end()) {
+                    return it->second;
+                }
+                uint32_t slot = static_cast<uint32_t>(device_ids.size());
+                device_slot.emplace(device_id, slot);
+                device_ids.push_back(device_id);
+                last_seen.push_back(0);
+                indexed.push_back(1);
+                for (auto& column : values) {
+                    column.push_back(kNaN);
+                }
+                return slot;
+            }
+
+            void unindex(size_t c, uint32_t slot) {
+                float old = values[c][slot];
+                if (!std::isnan(old)) {
+                    index[c].ordered.erase({old, slot});
+                    index[c].sum -= old;
+                }
+            }
+
+            void reindex(size_t c, uint32_t slot) {
+                float value = values[c][slot];
+                if (!std::isnan(value)) {
+                    index[c].ordered.insert({value, slot});
+                    index[c].sum += value;
+                }
+            }
+
+            int channelIndex(Sensor::ChannelId channel) const {
+                auto it = std::find(channels.begin(), channels.end(), channel);
+                return it == channels.end() ? -1 : static_cast<int>(it - channels.begin());
+            }
+
+            bool isFresh(uint32_t slot, Time::Timestamp now) const {
+                return config.stale_after <= 0 || now - last_seen[slot] <= config.stale_after;
+            }
+
+            /// @brief [begin, end) 디바이스 구간의 채널 c 부분 결과
+            void reduceRange(size_t c, size_t begin, size_t end, Time::Timestamp now, Partial& out) const {
+                const float* column = values[c].data();
+                for (size_t slot = begin; slot < end; ++slot) {
+                    const float value = column[slot];
+                    if (std::isnan(value) || !isFresh(static_cast<uint32_t>(slot), now)) {
+                        continue;
+                    }
+                    if (value < out.min) {
+                        out.min = value;
+                        out.min_device = device_ids[slot];
+                    }
+                    if (value > out.max) {
+                        out.max = value;
+                        out.max_device = device_ids[slot];
+                    }
+                    out.sum += value;
+                    out.count++;
+                    out.sketch.add(value);
+                }
+            }
+        };
+
+        /// @brief FleetAggregator 메서드 구현
+        FleetAggregator::FleetAggregator(const FleetConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        FleetAggregator::~FleetAggregator() = default;
+        FleetAggregator::FleetAggregator(FleetAggregator&&) noexcept = default;
+        FleetAggregator& FleetAggregator::operator=(FleetAggregator&&) noexcept = default;
+
+        void FleetAggregator::process(const Sensor::SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const uint32_t slot = pImpl->slotFor(batch.device_id);
+            pImpl->last_seen[slot] = std::max(pImpl->last_seen[slot], batch.timestamps_ns.back());
+            const bool was_indexed = pImpl->indexed[slot] != 0;
+            pImpl->indexed[slot] = 1;
+            const float alpha = pImpl->config.smoothing;
+
+            for (size_t c = 0; c < pImpl->channels.size(); ++c) {
+                const Sensor::ChannelId channel = pImpl->channels[c];
+                if (channel >= batch.channelCount()) {
+                    continue;
+                }
+                // 배치 전체를 EWMA로 접은 뒤 정렬 집합은 디바이스당 한 번만 갱신
+                float value = pImpl->values[c][slot];
+                for (float sample : batch.column(channel)) {
+                    if (!std::isnan(sample)) {
+                        value = std::isnan(value) ? sample : value + alpha * (sample - value);
+                    }
+                }
+                if (was_indexed) {
+                    pImpl->unindex(c, slot);
+                }
+                pImpl->values[c][slot] = value;
+                pImpl->reindex(c, slot);
+            }
+        }
+
+        bool FleetAggregator::getSummary(Sensor::ChannelId channel, ChannelSummary& out) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            int c = pImpl->channelIndex(channel);
+            if (c < 0 || pImpl->index[c].ordered.empty()) {
+                return false;
+            }
+            const auto& idx = pImpl->index[c];
+            out.channel = channel;
+            out.device_count = idx.ordered.size();
+            out.min = idx.ordered.begin()->first;
+            out.min_device = pImpl->device_ids[idx.ordered.begin()->second];
+            out.max = idx.ordered.rbegin()->first;
+            out.max_device = pImpl->device_ids[idx.ordered.rbegin()->second];
+            out.mean = static_cast<float>(idx.sum / static_cast<double>(out.device_count));
+            out.p50 = out.p90 = out.p99 = kNaN;
+            return true;
+        }
+
+        void FleetAggregator::getTopK(Sensor::ChannelId channel, size_t k, std::vector<DeviceRank>& out, bool highest) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            out.clear();
+            int c = pImpl->channelIndex(channel);
+            if (c < 0) {
+                return;
+            }
+            auto emit = [&](auto begin, auto end) {
+                for (auto it = begin; it != end && out.size() < k; ++it) {
+                    out.push_back({pImpl->device_ids[it->second], it->first});
+                }
+            };
+            const auto& ordered = pImpl->index[c].ordered;
+            if (highest) {
+                emit(ordered.rbegin(), ordered.rend());
+            } else {
+                emit(ordered.begin(), ordered.end());
+            }
+        }
+
+        size_t FleetAggregator::recompute(std::vector<ChannelSummary>& out, Time::Timestamp now) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            out.clear();
+            const size_t devices = pImpl->device_ids.size();
+            const size_t channel_count = pImpl->channels.size();
+
+            unsigned workers = 1;
+            if (devices >= pImpl->config.parallel_threshold) {
+                unsigned hardware = pImpl->config.max_threads ? pImpl->config.max_threads
+                                                              : std::max(1u, std::thread::hardware_concurrency());
+                size_t by_size = devices / std::max<size_t>(pImpl->config.parallel_threshold / 2, 1);
+                workers = static_cast<unsigned>(std::clamp<size_t>(by_size, 1, hardware));
+            }
+
+            // partials[worker][channel]
+            std::vector<std::vector<Partial>> partials(workers, std::vector<Partial>(channel_count));
+            auto run = [&](unsigned w) {
+                size_t begin = devices * w / workers;
+                size_t end = devices * (w + 1) / workers;
+                for (size_t c = 0; c < channel_count; ++c) {
+                    pImpl->reduceRange(c, begin, end, now, partials[w][c]);
+                }
+            };
+            if (workers == 1) {
+                run(0);
+            } else {
+                std::vector<std::thread> threads;
+                threads.reserve(workers - 1);
+                for (unsigned w = 1; w < workers; ++w) {
+                    threads.emplace_back(run, w);
+                }
+                run(0);
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+
+            for (size_t c = 0; c < channel_count; ++c) {
+                Partial& total = partials[0][c];
+                for (unsigned w = 1; w < workers; ++w) {
+                    total.merge(partials[w][c]);
+                }
+                if (total.count == 0) {
+                    continue;
+                }
+                ChannelSummary summary;
+                summary.channel = pImpl->channels[c];
+                summary.device_count = total.count;
+                summary.min = total.min;
+                summary.max = total.max;
+                summary.min_device = total.min_device;
+                summary.max_device = total.max_device;
+                summary.mean = static_cast<float>(total.sum / static_cast<double>(total.count));
+                const double qs[] = { 0.5, 0.9, 0.99 };
+                float quantiles[3];
+                total.sketch.quantiles(qs, quantiles, 3);
+                summary.p50 = quantiles[0];
+                summary.p90 = quantiles[1];
+                summary.p99 = quantiles[2];
+                out.push_back(summary);
+            }
+            return out.size();
+        }
+
+        size_t FleetAggregator::expireStale(Time::Timestamp now) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            size_t expired = 0;
+            for (uint32_t slot = 0; slot < pImpl->device_ids.size(); ++slot) {
+                if (pImpl->indexed[slot] && !pImpl->isFresh(slot, now)) {
+                    for (size_t c = 0; c < pImpl->channels.size(); ++c) {
+                        pImpl->unindex(c, slot);
+                    }
+                    pImpl->indexed[slot] = 0;
+                    ++expired;
+                }
+            }
+            return expired;
+        }
+
+        size_t FleetAggregator::getDeviceCount() const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return pImpl->device_ids.size();
+        }
+
+        const FleetConfig& FleetAggregator::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
@@ -0,0 +1,231 @@
+#include "core/analytics/HistogramStore.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr int64_t kEmptyBucket = std::numeric_limits<int64_t>::min();
+
+            int64_t bucketIndex(Time::Timestamp t, Time::Timestamp bucket_ns) {
+                int64_t index = t / bucket_ns;
+                return (t % bucket_ns < 0) ? index - 1 : index;
+            }
+        }
+
+        /// @brief HistogramStore 구현 클래스 (Pimpl 패턴)
+        class HistogramStore::Impl {
+        public:
+            /// @brief 채널 하나의 구간 링
+            struct ChannelHistogram {
+                HistogramSpec spec;
+                float origin = 0.0f;          // 변환된 공간의 min
+                float inv_width = 1.0f;       // 변환된 공간에서 빈 폭의 역수
+                std::vector<int64_t> bucket_index;   // [slot] 이 칸에 든 구간 번호
+                std::vector<uint32_t> counts;        // [slot][bin]
+                int64_t newest = kEmptyBucket;
+                uint64_t out_of_range = 0;
+
+                float transform(float value) const {
+                    return spec.scale == BinScale::LOG ? std::log(value) : value;
+                }
+
+                uint16_t bin(float value) const {
+                    // LOG에서 0 이하 값은 -inf/NaN이 되어 첫 빈으로 감
+                    float position = (transform(value) - origin) * inv_width;
+                    if (!(position >= 0.0f)) {
+                        return 0;
+                    }
+                    return static_cast<uint16_t>(std::min(position, static_cast<float>(spec.bins - 1)));
+                }
+
+                bool inRange(float value) const {
+                    return value >= spec.min && value <= spec.max;
+                }
+            };
+
+            HistogramConfig config;
+            std::vector<ChannelHistogram> histograms;
+            mutable std::mutex mutex;
+
+            explicit Impl(const HistogramConfig& cfg) : config(cfg) {
+                if (config.bucket_ns <= 0) {
+                    config.bucket_ns = 10 * Time::kNanosPerSecond;
+                }
+                config.retention_buckets = std::max<size_t>(config.retention_buckets, 1);
+
+                for (auto& spec : config.channels) {
+                    spec.bins = std::max<uint16_t>(spec.bins, 1);
+                    if (spec.scale == BinScale::LOG && spec.min <= 0.0f) {
+                        spec.min = std::max(spec.max * 1e-6f, std::numeric_limits<float>::min());
+                    }
+                    if (spec.max <= spec.min) {
+                        spec.max = spec.min + 1.0f;
+                    }
+                    ChannelHistogram h;
+                    h.spec = spec;
+                    h.origin = h.transform(spec.min);
+                    h.inv_width = spec.bins / (h.transform(spec.max) - h.origin);
+                    h.bucket_index.assign(config.retention_buckets, kEmptyBucket);
+                    h.counts.assign(config.retention_buckets * spec.bins, 0);
+                    histograms.push_back(std::move(h));
+                }
+            }
+
+            const ChannelHistogram* find(Sensor::ChannelId channel) const {
+                for (const auto& h : histograms) {
+                    if (h.spec.channel == channel) {
+                        return &h;
+                    }
+                }
+                return nullptr;
+            }
+
+            /// @brief 구간의 카운터 행. 보관 범위보다 오래된 구간이면 nullptr
+            uint32_t* row(ChannelHistogram& h, int64_t index) {
+                const int64_t retention = static_cast<int64_t>(config.retention_buckets);
+                if (h.newest != kEmptyBucket && index <= h.newest - retention) {
+                    return nullptr;
+                }
+                h.newest = std::max(h.newest, index);
+                const size_t slot = static_cast<size_t>(((index % retention) + retention) % retention);
+                uint32_t* counts = h.counts.data() + slot * h.spec.bins;
+                if (h.bucket_index[slot] != index) {
+                    h.bucket_index[slot] = index;
+                    std::fill(counts, counts + h.spec.bins, 0u);
+                }
+                return counts;
+            }
+        };
+
+        /// @brief HistogramStore 메서드 구현
+        HistogramStore::HistogramStore(const HistogramConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        HistogramStore::~HistogramStore() = default;
+        HistogramStore::HistogramStore(HistogramStore&&) noexcept = default;
+        HistogramStore& HistogramStore::operator=(HistogramStore&&) noexcept = default;
+
+        void HistogramStore::process(const Sensor::SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Time::Timestamp bucket_ns = pImpl->config.bucket_ns;
+            for (auto& h : pImpl->histograms) {
+                if (h.spec.channel >= batch.channelCount()) {
+                    continue;
+                }
+                const std::vector<float>& column = batch.column(h.spec.channel);
+                uint32_t* counts = nullptr;
+                int64_t current = kEmptyBucket;
+                for (size_t i = 0; i < column.size(); ++i) {
+                    const float value = column[i];
+                    if (std::isnan(value)) {
+                        continue;
+                    }
+                    int64_t index = bucketIndex(batch.timestamps_ns[i], bucket_ns);
+                    if (index != current) {
+                        counts = pImpl->row(h, index);
+                        current = index;
+                    }
+                    if (!counts) {
+                        continue;
+                    }
+                    counts[h.bin(value)]++;
+                    if (!h.inRange(value)) {
+                        h.out_of_range++;
+                    }
+                }
+            }
+        }
+
+        bool HistogramStore::getHeatmap(Sensor::ChannelId channel, std::vector<float>& values, size_t& rows, size_t& cols,
+                                        Time::Timestamp& first_bucket_start, bool normalize) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::ChannelHistogram* h = pImpl->find(channel);
+            rows = cols = 0;
+            if (!h || h->newest == kEmptyBucket) {
+                return false;
+            }
+            const size_t bins = h->spec.bins;
+            const int64_t retention = static_cast<int64_t>(pImpl->config.retention_buckets);
+            const int64_t first = h->newest - retention + 1;
+            rows = bins;
+            cols = static_cast<size_t>(retention);
+            values.assign(rows * cols, 0.0f);
+            first_bucket_start = first * pImpl->config.bucket_ns;
+
+            for (size_t c = 0; c < cols; ++c) {
+                const int64_t index = first + static_cast<int64_t>(c);
+                const size_t slot = static_cast<size_t>(((index % retention) + retention) % retention);
+                if (h->bucket_index[slot] != index) {
+                    continue;
+                }
+                const uint32_t* counts = h->counts.data() + slot * bins;
+                float total = 0.0f;
+                if (normalize) {
+                    for (size_t b = 0; b < bins; ++b) {
+                        total += static_cast<float>(counts[b]);
+                    }
+                }
+                const float scale = (normalize && total > 0.0f) ? 1.0f / total : 1.0f;
+                for (size_t b = 0; b < bins; ++b) {
+                    values[(bins - 1 - b) * cols + c] = static_cast<float>(counts[b]) * scale;
+                }
+            }
+            return true;
+        }
+
+        bool HistogramStore::getDistribution(Sensor::ChannelId channel, size_t buckets, std::vector<uint64_t>& counts) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::ChannelHistogram* h = pImpl->find(channel);
+            if (!h || h->newest == kEmptyBucket) {
+                return false;
+            }
+            const size_t bins = h->spec.bins;
+            const int64_t retention = static_cast<int64_t>(pImpl->config.retention_buckets);
+            const int64_t span = std::min<int64_t>(static_cast<int64_t>(buckets), retention);
+            counts.assign(bins, 0);
+            for (int64_t index = h->newest - span + 1; index <= h->newest; ++index) {
+                const size_t slot = static_cast<size_t>(((index % retention) + retention) % retention);
+                if (h->bucket_index[slot] != index) {
+                    continue;
+                }
+                const uint32_t* row = h->counts.data() + slot * bins;
+                for (size_t b = 0; b < bins; ++b) {
+                    counts[b] += row[b];
+                }
+            }
+            return true;
+        }
+
+        bool HistogramStore::getBinEdges(Sensor::ChannelId channel, std::vector<float>& edges) const {
+            const Impl::ChannelHistogram* h = pImpl->find(channel);
+            if (!h) {
+                return false;
+            }
+            const HistogramSpec& spec = h->spec;
+            edges.resize(spec.bins + 1);
+            for (size_t b = 0; b <= spec.bins; ++b) {
+                float t = static_cast<float>(b) / static_cast<float>(spec.bins);
+                edges[b] = spec.scale == BinScale::LOG
+                    ? spec.min * std::pow(spec.max / spec.min, t)
+                    : spec.min + (spec.max - spec.min) * t;
+            }
+            return true;
+        }
+
+        uint64_t HistogramStore::getOutOfRangeCount(Sensor::ChannelId channel) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::ChannelHistogram* h = pImpl->find(channel);
+            return h ? h->out_of_range : 0;
+        }
+
+        const HistogramConfig& HistogramStore::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
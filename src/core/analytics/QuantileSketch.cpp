@@ -0,0 +1,353 @@
+#include "core/analytics/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr double kLevelShrink = 2.0 / 3.0;
+
+            uint64_t seriesKey(uint32_t device_id, Sensor::ChannelId channel) {
+                return (static_cast<uint64_t>(device_id) << 16) | channel;
+            }
+
+            int64_t bucketIndex(Time::Timestamp t, Time::Timestamp bucket_ns) {
+                int64_t index = t / bucket_ns;
+                return (t % bucket_ns < 0) ? index - 1 : index;
+            }
+        }
+
+        /// @brief QuantileSketch 메서드 구현
+        QuantileSketch::QuantileSketch(uint16_t k) : k(std::max<uint16_t>(k, 8)) {}
+
+        size_t QuantileSketch::capacity(size_t level) const {
+            size_t depth = levels.size() - 1 - level;
+            double cap = std::ceil(static_cast<double>(k) * std::pow(kLevelShrink, static_cast<double>(depth)));
+            return std::max<size_t>(2, static_cast<size_t>(cap));
+        }
+
+        void QuantileSketch::add(float value) {
+            if (std::isnan(value)) {
+                return;
+            }
+            if (levels.empty()) {
+                levels.emplace_back();
+                total_capacity = totalCapacity();
+            }
+            levels[0].push_back(value);
+            ++n;
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+            if (++retained_count >= total_capacity) {
+                compress();
+            }
+        }
+
+        void QuantileSketch::add(const float* values, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                add(values[i]);
+            }
+        }
+
+        void QuantileSketch::compactLevel(size_t level) {
+            if (level + 1 == levels.size()) {
+                levels.emplace_back();
+            }
+            std::vector<float>& current = levels[level];
+            std::vector<float>& above = levels[level + 1];
+            std::sort(current.begin(), current.end());
+
+            // 홀수 개면 가장 큰 값 하나는 이 레벨에 남김
+            const bool odd = current.size() % 2 == 1;
+            const float leftover = odd ? current.back() : 0.0f;
+            const size_t even = current.size() - (odd ? 1 : 0);
+            const size_t offset = (compactions++) & 1;
+            for (size_t i = offset; i < even; i += 2) {
+                above.push_back(current[i]);
+            }
+            current.clear();
+            if (odd) {
+                current.push_back(leftover);
+            }
+        }
+
+        size_t QuantileSketch::totalCapacity() const {
+            size_t total = 0;
+            for (size_t level = 0; level < levels.size(); ++level) {
+                total += capacity(level);
+            }
+            return total;
+        }
+
+        void QuantileSketch::compress() {
+            // 전체 크기가 용량 합을 넘을 때만, 넘친 레벨을 아래부터 필요한 만큼만 압축 (lazy KLL)
+            size_t size = retained();
+            size_t limit = totalCapacity();
+            for (size_t level = 0; level < levels.size() && size >= limit; ++level) {
+                if (levels[level].size() >= capacity(level)) {
+                    const size_t levels_before = levels.size();
+                    compactLevel(level);
+                    size = retained();
+                    if (levels.size() != levels_before) {
+                        limit = totalCapacity();
+                    }
+                }
+            }
+            retained_count = size;
+            total_capacity = limit;
+        }
+
+        void QuantileSketch::merge(const QuantileSketch& other) {
+            if (other.n == 0) {
+                return;
+            }
+            if (levels.size() < other.levels.size()) {
+                levels.resize(other.levels.size());
+            }
+            for (size_t level = 0; level < other.levels.size(); ++level) {
+                levels[level].insert(levels[level].end(), other.levels[level].begin(), other.levels[level].end());
+            }
+            n += other.n;
+            min_value = std::min(min_value, other.min_value);
+            max_value = std::max(max_value, other.max_value);
+            compress();
+        }
+
+        void QuantileSketch::clear() {
+            levels.clear();
+            n = 0;
+            min_value = std::numeric_limits<float>::infinity();
+            max_value = -std::numeric_limits<float>::infinity();
+            retained_count = 0;
+            total_capacity = 0;
+            compactions = 0;
+        }
+
+        size_t QuantileSketch::retained() const {
+            size_t total = 0;
+            for (const auto& level : levels) {
+                total += level.size();
+            }
+            return total;
+        }
+
+        void QuantileSketch::sortedWeights(std::vector<std::pair<float, uint64_t>>& out) const {
+            out.clear();
+            out.reserve(retained());
+            for (size_t level = 0; level < levels.size(); ++level) {
+                for (float value : levels[level]) {
+                    out.emplace_back(value, uint64_t(1) << level);
+                }
+            }
+            std::sort(out.begin(), out.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+        }
+
+        float QuantileSketch::quantile(double q) const {
+            float result;
+            quantiles(&q, &result, 1);
+            return result;
+        }
+
+        void QuantileSketch::quantiles(const double* qs, float* out, size_t count) const {
+            if (n == 0) {
+                std::fill(out, out + count, std::nanf(""));
+                return;
+            }
+            std::vector<std::pair<float, uint64_t>> weighted;
+            sortedWeights(weighted);
+            uint64_t total = 0;
+            for (const auto& entry : weighted) {
+                total += entry.second;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                double q = qs[i];
+                if (q <= 0.0) {
+                    out[i] = min_value;
+                    continue;
+                }
+                if (q >= 1.0) {
+                    out[i] = max_value;
+                    continue;
+                }
+                const double target = q * static_cast<double>(total);
+                uint64_t cumulative = 0;
+                out[i] = weighted.back().first;
+                for (const auto& entry : weighted) {
+                    cumulative += entry.second;
+                    if (static_cast<double>(cumulative) >= target) {
+                        out[i] = entry.first;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /// @brief QuantileStore 구현 클래스 (Pimpl 패턴)
+        class QuantileStore::Impl {
+        public:
+            struct Bucket {
+                int64_t index;
+                QuantileSketch sketch;
+            };
+            /// @brief 디바이스 x 채널 하나의 구간 목록 (시간순)
+            struct Series {
+                uint32_t device_id;
+                Sensor::ChannelId channel;
+                std::deque<Bucket> buckets;
+            };
+
+            QuantileStoreConfig config;
+            std::unordered_map<uint64_t, Series> series;
+            std::unordered_set<uint32_t> devices;
+            mutable std::mutex mutex;
+
+            explicit Impl(const QuantileStoreConfig& cfg) : config(cfg) {
+                if (config.bucket_ns <= 0) {
+                    config.bucket_ns = 10 * Time::kNanosPerSecond;
+                }
+                config.retention_buckets = std::max<size_t>(config.retention_buckets, 1);
+            }
+
+            /// @brief 구간 찾기/생성. 보관 범위보다 오래된 구간이면 nullptr
+            QuantileSketch* bucket(Series& s, int64_t index) {
+                auto& buckets = s.buckets;
+                if (buckets.empty() || index > buckets.back().index) {
+                    buckets.push_back({index, QuantileSketch(config.k)});
+                    while (buckets.back().index - buckets.front().index >= static_cast<int64_t>(config.retention_buckets)) {
+                        buckets.pop_front();
+                    }
+                    return &buckets.back().sketch;
+                }
+                // 늦게 도착한 샘플: 뒤에서부터 찾고 없으면 그 자리에 삽입
+                for (auto it = buckets.rbegin(); it != buckets.rend(); ++it) {
+                    if (it->index == index) {
+                        return &it->sketch;
+                    }
+                    if (it->index < index) {
+                        return &buckets.insert(it.base(), {index, QuantileSketch(config.k)})->sketch;
+                    }
+                }
+                if (buckets.back().index - index < static_cast<int64_t>(config.retention_buckets)) {
+                    buckets.push_front({index, QuantileSketch(config.k)});
+                    return &buckets.front().sketch;
+                }
+                return nullptr;
+            }
+
+            void addColumn(Series& s, const std::vector<float>& column, const std::vector<Time::Timestamp>& timestamps) {
+                QuantileSketch* current = nullptr;
+                int64_t current_index = 0;
+                for (size_t i = 0; i < column.size(); ++i) {
+                    int64_t index = bucketIndex(timestamps[i], config.bucket_ns);
+                    if (!current || index != current_index) {
+                        current = bucket(s, index);
+                        current_index = index;
+                    }
+                    if (current) {
+                        current->add(column[i]);
+                    }
+                }
+            }
+
+            template <typename Func>
+            void forEachSeries(Sensor::ChannelId channel, uint32_t device_id, Func&& func) const {
+                for (const auto& entry : series) {
+                    const Series& s = entry.second;
+                    if (s.channel == channel && (device_id == kAllDevices || s.device_id == device_id)) {
+                        func(s);
+                    }
+                }
+            }
+        };
+
+        /// @brief QuantileStore 메서드 구현
+        QuantileStore::QuantileStore(const QuantileStoreConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        QuantileStore::~QuantileStore() = default;
+        QuantileStore::QuantileStore(QuantileStore&&) noexcept = default;
+        QuantileStore& QuantileStore::operator=(QuantileStore&&) noexcept = default;
+
+        void QuantileStore::process(const Sensor::SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->devices.insert(batch.device_id);
+
+            auto addChannel = [&](Sensor::ChannelId channel) {
+                if (channel >= batch.channelCount()) {
+                    return;
+                }
+                auto key = seriesKey(batch.device_id, channel);
+                auto it = pImpl->series.find(key);
+                if (it == pImpl->series.end()) {
+                    it = pImpl->series.emplace(key, Impl::Series{batch.device_id, channel, {}}).first;
+                }
+                pImpl->addColumn(it->second, batch.column(channel), batch.timestamps_ns);
+            };
+
+            if (pImpl->config.channels.empty()) {
+                for (size_t ch = 0; ch < batch.channelCount(); ++ch) {
+                    addChannel(static_cast<Sensor::ChannelId>(ch));
+                }
+            } else {
+                for (Sensor::ChannelId channel : pImpl->config.channels) {
+                    addChannel(channel);
+                }
+            }
+        }
+
+        bool QuantileStore::query(Sensor::ChannelId channel, Time::Timestamp from, Time::Timestamp to,
+                                  QuantileSketch& out, uint32_t device_id) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Time::Timestamp bucket_ns = pImpl->config.bucket_ns;
+            out.clear();
+            pImpl->forEachSeries(channel, device_id, [&](const Impl::Series& s) {
+                for (const auto& b : s.buckets) {
+                    Time::Timestamp start = b.index * bucket_ns;
+                    if (start < to && start + bucket_ns > from) {
+                        out.merge(b.sketch);
+                    }
+                }
+            });
+            return !out.empty();
+        }
+
+        size_t QuantileStore::getBucketQuantiles(Sensor::ChannelId channel, const double* qs, size_t count,
+                                                 std::vector<Time::Timestamp>& starts, std::vector<float>& values,
+                                                 uint32_t device_id) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            std::map<int64_t, QuantileSketch> merged;
+            pImpl->forEachSeries(channel, device_id, [&](const Impl::Series& s) {
+                for (const auto& b : s.buckets) {
+                    merged.try_emplace(b.index, pImpl->config.k).first->second.merge(b.sketch);
+                }
+            });
+
+            starts.clear();
+            values.resize(merged.size() * count);
+            for (const auto& entry : merged) {
+                entry.second.quantiles(qs, values.data() + starts.size() * count, count);
+                starts.push_back(entry.first * pImpl->config.bucket_ns);
+            }
+            return starts.size();
+        }
+
+        size_t QuantileStore::getDeviceCount() const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return pImpl->devices.size();
+        }
+
+        const QuantileStoreConfig& QuantileStore::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
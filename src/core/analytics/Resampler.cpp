@@ -0,0 +1,202 @@
+#include "core/analytics/Resampler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            /// @brief 음수에서도 올바른 내림 나눗셈
+            int64_t floorDiv(int64_t a, int64_t b) {
+                int64_t q = a / b;
+                return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+            }
+
+            constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+        }
+
+        int64_t gridIndex(Time::Timestamp t, Time::Timestamp origin, Time::Timestamp period) {
+            return floorDiv(t - origin + period / 2, period);
+        }
+
+        /// @brief Resampler 구현 클래스 (Pimpl 패턴)
+        class Resampler::Impl {
+        public:
+            ResamplerConfig config;
+
+            bool started = false;
+            size_t channels = 0;
+
+            // HOLD_LAST / LINEAR
+            Time::Timestamp next_grid = 0;
+            Time::Timestamp prev_time = 0;
+            std::vector<float> prev_values;
+            uint32_t prev_quality = 0;
+
+            // BUCKET_MEAN
+            int64_t bucket = 0;
+            std::vector<double> sums;
+            uint32_t bucket_count = 0;
+            uint32_t bucket_quality = 0;
+
+            explicit Impl(const ResamplerConfig& cfg) : config(cfg) {
+                if (config.period <= 0) {
+                    config.period = Time::kNanosPerSecond;
+                }
+            }
+
+            Time::Timestamp gridAtOrAfter(Time::Timestamp t) const {
+                int64_t k = -floorDiv(-(t - config.origin), config.period);   // 올림
+                return config.origin + k * config.period;
+            }
+
+            void prepareOutput(const Sensor::SensorBatch& in, Sensor::SensorBatch& out) {
+                if (channels == 0) {
+                    channels = in.channelCount();
+                    prev_values.assign(channels, 0.0f);
+                    sums.assign(channels, 0.0);
+                }
+                out.device_id = in.device_id;
+                out.ensureChannels(channels);
+            }
+
+            static uint32_t qualityAt(const Sensor::SensorBatch& in, size_t i) {
+                return i < in.quality.size() ? in.quality[i] : 0;
+            }
+
+            /// @brief 격자 점 한 개를 출력 (채널 수가 더 많은 출력 배치는 NaN으로 채움)
+            /// @param quality 값을 만든 원본 샘플들의 품질 비트 OR
+            template <typename ValueAt>
+            void emit(Sensor::SensorBatch& out, Time::Timestamp t, uint32_t quality, ValueAt&& valueAt) {
+                out.quality.resize(out.timestamps_ns.size(), 0);
+                out.timestamps_ns.push_back(t);
+                out.quality.push_back(quality);
+                for (size_t ch = 0; ch < out.channelCount(); ++ch) {
+                    out.columns[ch].push_back(ch < channels ? valueAt(ch) : kNaN);
+                }
+            }
+
+            size_t processPointwise(const Sensor::SensorBatch& in, Sensor::SensorBatch& out) {
+                size_t emitted = 0;
+                const bool linear = (config.method == ResampleMethod::LINEAR);
+                size_t in_channels = std::min(channels, in.channelCount());
+
+                for (size_t i = 0; i < in.size(); ++i) {
+                    Time::Timestamp t = in.timestamps_ns[i];
+                    if (started && t <= prev_time) {
+                        continue;   // 역순/중복 샘플 무시
+                    }
+
+                    bool restart = !started || (config.max_gap > 0 && t - prev_time > config.max_gap);
+                    if (restart) {
+                        started = true;
+                        next_grid = gridAtOrAfter(t);
+                    } else {
+                        double span = static_cast<double>(t - prev_time);
+                        const uint32_t quality = linear ? prev_quality | qualityAt(in, i) : prev_quality;
+                        while (next_grid < t) {
+                            double w = static_cast<double>(next_grid - prev_time) / span;
+                            emit(out, next_grid, quality, [&](size_t ch) {
+                                if (!linear) {
+                                    return prev_values[ch];
+                                }
+                                float cur = ch < in_channels ? in.columns[ch][i] : prev_values[ch];
+                                return static_cast<float>(prev_values[ch] + (cur - prev_values[ch]) * w);
+                            });
+                            next_grid += config.period;
+                            ++emitted;
+                        }
+                    }
+
+                    prev_time = t;
+                    prev_quality = qualityAt(in, i);
+                    for (size_t ch = 0; ch < in_channels; ++ch) {
+                        prev_values[ch] = in.columns[ch][i];
+                    }
+                }
+                return emitted;
+            }
+
+            size_t emitBucket(Sensor::SensorBatch& out) {
+                Time::Timestamp t = config.origin + bucket * config.period;
+                uint32_t count = bucket_count;
+                emit(out, t, bucket_quality, [&](size_t ch) {
+                    return count > 0 ? static_cast<float>(sums[ch] / count) : kNaN;
+                });
+                sums.assign(channels, 0.0);
+                bucket_count = 0;
+                bucket_quality = 0;
+                return 1;
+            }
+
+            size_t processBuckets(const Sensor::SensorBatch& in, Sensor::SensorBatch& out) {
+                size_t emitted = 0;
+                size_t in_channels = std::min(channels, in.channelCount());
+                int64_t max_gap_buckets = config.max_gap > 0 ? config.max_gap / config.period : 0;
+
+                for (size_t i = 0; i < in.size(); ++i) {
+                    int64_t b = floorDiv(in.timestamps_ns[i] - config.origin, config.period);
+                    if (!started) {
+                        started = true;
+                        bucket = b;
+                    }
+                    if (b < bucket) {
+                        continue;   // 이미 닫힌 구간의 늦은 샘플
+                    }
+                    while (b > bucket) {
+                        emitted += emitBucket(out);
+                        ++bucket;
+                        if (max_gap_buckets > 0 && b - bucket > max_gap_buckets) {
+                            bucket = b;   // 긴 공백은 빈 구간을 만들지 않고 건너뜀
+                        }
+                    }
+                    for (size_t ch = 0; ch < in_channels; ++ch) {
+                        sums[ch] += in.columns[ch][i];
+                    }
+                    ++bucket_count;
+                    bucket_quality |= qualityAt(in, i);
+                }
+                return emitted;
+            }
+        };
+
+        /// @brief Resampler 메서드 구현
+        Resampler::Resampler(const ResamplerConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        Resampler::~Resampler() = default;
+        Resampler::Resampler(Resampler&&) noexcept = default;
+        Resampler& Resampler::operator=(Resampler&&) noexcept = default;
+
+        size_t Resampler::process(const Sensor::SensorBatch& in, Sensor::SensorBatch& out) {
+            if (in.empty()) {
+                return 0;
+            }
+            pImpl->prepareOutput(in, out);
+            if (pImpl->config.method == ResampleMethod::BUCKET_MEAN) {
+                return pImpl->processBuckets(in, out);
+            }
+            return pImpl->processPointwise(in, out);
+        }
+
+        size_t Resampler::flush(Sensor::SensorBatch& out) {
+            if (pImpl->config.method != ResampleMethod::BUCKET_MEAN || pImpl->bucket_count == 0) {
+                return 0;
+            }
+            out.ensureChannels(pImpl->channels);
+            size_t emitted = pImpl->emitBucket(out);
+            ++pImpl->bucket;
+            return emitted;
+        }
+
+        void Resampler::reset() {
+            ResamplerConfig config = pImpl->config;
+            pImpl = std::make_unique<Impl>(config);
+        }
+
+        const ResamplerConfig& Resampler::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
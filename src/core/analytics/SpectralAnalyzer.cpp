@@ -0,0 +1,271 @@
+#include "core/analytics/SpectralAnalyzer.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr double kPi = 3.14159265358979323846;
+
+            uint64_t streamKey(uint32_t device_id, Sensor::ChannelId channel) {
+                return (static_cast<uint64_t>(device_id) << 16) | channel;
+            }
+        }
+
+        /// @brief SlidingDft 메서드 구현
+        SlidingDft::SlidingDft(size_t window) : window(std::max<size_t>((window + 1) & ~size_t(1), 4)) {
+            const size_t bin_count = this->window / 2 + 1;
+            bins.assign(bin_count, {0.0, 0.0});
+            twiddles.resize(bin_count);
+            for (size_t k = 0; k < bin_count; ++k) {
+                double angle = 2.0 * kPi * static_cast<double>(k) / static_cast<double>(this->window);
+                twiddles[k] = {std::cos(angle), std::sin(angle)};
+            }
+            history.assign(this->window, 0.0);
+        }
+
+        void SlidingDft::push(float sample) {
+            const double x = sample;
+            const double delta = x - history[head];
+            history[head] = x;
+            head = (head + 1) % window;
+            if (filled < window) {
+                ++filled;
+            }
+
+            const size_t bin_count = bins.size();
+            for (size_t k = 0; k < bin_count; ++k) {
+                bins[k] = (bins[k] + delta) * twiddles[k];
+            }
+
+            if (++since_resync >= window * kResyncWindows) {
+                resync();
+            }
+        }
+
+        void SlidingDft::resync() {
+            // 재귀식 결과는 가장 오래된 샘플(head)을 n = 0으로 둔 DFT와 같음
+            const size_t bin_count = bins.size();
+            for (size_t k = 0; k < bin_count; ++k) {
+                std::complex<double> sum{0.0, 0.0};
+                for (size_t n = 0; n < window; ++n) {
+                    double angle = -2.0 * kPi * static_cast<double>(k * n % window) / static_cast<double>(window);
+                    sum += history[(head + n) % window] * std::complex<double>(std::cos(angle), std::sin(angle));
+                }
+                bins[k] = sum;
+            }
+            since_resync = 0;
+        }
+
+        void SlidingDft::reset() {
+            std::fill(bins.begin(), bins.end(), std::complex<double>{0.0, 0.0});
+            std::fill(history.begin(), history.end(), 0.0);
+            head = 0;
+            filled = 0;
+            since_resync = 0;
+        }
+
+        void SlidingDft::getMagnitudes(float* out, bool hann) const {
+            const size_t bin_count = bins.size();
+            const double scale = 1.0 / static_cast<double>(window);
+            for (size_t k = 0; k < bin_count; ++k) {
+                std::complex<double> value = bins[k];
+                if (hann) {
+                    // Hann 창: 0.5X[k] - 0.25(X[k-1] + X[k+1])를 코히어런트 이득 0.5로 보정
+                    // 경계 빈은 실수 신호의 켤레 대칭 X[-k] = conj(X[k])로 처리
+                    std::complex<double> prev = k > 0 ? bins[k - 1] : std::conj(bins[1]);
+                    std::complex<double> next = k + 1 < bin_count ? bins[k + 1] : std::conj(bins[k - 1]);
+                    value = value - 0.5 * (prev + next);
+                }
+                double magnitude = std::abs(value) * scale;
+                if (k > 0 && 2 * k != window) {
+                    magnitude *= 2.0;   // 단측 스펙트럼
+                }
+                out[k] = static_cast<float>(magnitude);
+            }
+        }
+
+        /// @brief SpectralAnalyzer 구현 클래스 (Pimpl 패턴)
+        class SpectralAnalyzer::Impl {
+        public:
+            /// @brief 디바이스 x 채널 하나의 분석 상태
+            struct Stream {
+                SlidingDft dft;
+                double accumulator = 0.0;      // 데시메이션 평균
+                size_t accumulated = 0;
+                size_t since_column = 0;
+
+                Time::Timestamp last_timestamp = 0;
+                double mean_interval_ns = 0.0;  // 원본 샘플 간격 EWMA
+
+                std::vector<float> spectrogram; // [column][bin] 링 버퍼
+                size_t column_head = 0;
+                size_t column_count = 0;
+
+                explicit Stream(size_t window) : dft(window) {}
+            };
+
+            SpectralConfig config;
+            std::vector<Sensor::ChannelId> channels;
+            std::unordered_map<uint64_t, Stream> streams;
+            mutable std::mutex mutex;
+
+            explicit Impl(const SpectralConfig& cfg) : config(cfg) {
+                config.window = std::max<size_t>((config.window + 1) & ~size_t(1), 4);   // SlidingDft와 같게 짝수로
+                config.decimation = std::max<size_t>(config.decimation, 1);
+                config.spectrogram_hop = std::max<size_t>(config.spectrogram_hop, 1);
+                config.spectrogram_columns = std::max<size_t>(config.spectrogram_columns, 1);
+            }
+
+            size_t binCount() const { return config.window / 2 + 1; }
+
+            Stream& stream(uint32_t device_id, Sensor::ChannelId channel) {
+                auto it = streams.find(streamKey(device_id, channel));
+                if (it == streams.end()) {
+                    it = streams.emplace(streamKey(device_id, channel), Stream(config.window)).first;
+                    it->second.spectrogram.assign(config.spectrogram_columns * binCount(), 0.0f);
+                }
+                return it->second;
+            }
+
+            const Stream* findStream(uint32_t device_id, Sensor::ChannelId channel) const {
+                auto it = streams.find(streamKey(device_id, channel));
+                return it != streams.end() ? &it->second : nullptr;
+            }
+
+            void pushColumn(Stream& s) {
+                const size_t bins = binCount();
+                s.dft.getMagnitudes(s.spectrogram.data() + s.column_head * bins, config.hann);
+                s.column_head = (s.column_head + 1) % config.spectrogram_columns;
+                s.column_count = std::min(s.column_count + 1, config.spectrogram_columns);
+            }
+
+            void feed(Stream& s, const float* values, const Time::Timestamp* timestamps, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    if (s.last_timestamp != 0 && timestamps[i] > s.last_timestamp) {
+                        double interval = static_cast<double>(timestamps[i] - s.last_timestamp);
+                        s.mean_interval_ns = s.mean_interval_ns > 0.0
+                            ? s.mean_interval_ns + 0.05 * (interval - s.mean_interval_ns)
+                            : interval;
+                    }
+                    s.last_timestamp = timestamps[i];
+
+                    if (!std::isfinite(values[i])) {
+                        continue;
+                    }
+                    s.accumulator += values[i];
+                    if (++s.accumulated < config.decimation) {
+                        continue;
+                    }
+                    s.dft.push(static_cast<float>(s.accumulator / static_cast<double>(s.accumulated)));
+                    s.accumulator = 0.0;
+                    s.accumulated = 0;
+
+                    if (s.dft.isReady() && ++s.since_column >= config.spectrogram_hop) {
+                        s.since_column = 0;
+                        pushColumn(s);
+                    }
+                }
+            }
+        };
+
+        /// @brief SpectralAnalyzer 메서드 구현
+        SpectralAnalyzer::SpectralAnalyzer(const SpectralConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        SpectralAnalyzer::~SpectralAnalyzer() = default;
+        SpectralAnalyzer::SpectralAnalyzer(SpectralAnalyzer&&) noexcept = default;
+        SpectralAnalyzer& SpectralAnalyzer::operator=(SpectralAnalyzer&&) noexcept = default;
+
+        void SpectralAnalyzer::addChannel(Sensor::ChannelId channel) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            if (std::find(pImpl->channels.begin(), pImpl->channels.end(), channel) == pImpl->channels.end()) {
+                pImpl->channels.push_back(channel);
+            }
+        }
+
+        void SpectralAnalyzer::removeChannel(Sensor::ChannelId channel) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            auto& channels = pImpl->channels;
+            channels.erase(std::remove(channels.begin(), channels.end(), channel), channels.end());
+            for (auto it = pImpl->streams.begin(); it != pImpl->streams.end();) {
+                if (static_cast<Sensor::ChannelId>(it->first & 0xFFFF) == channel) {
+                    it = pImpl->streams.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        bool SpectralAnalyzer::hasChannel(Sensor::ChannelId channel) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return std::find(pImpl->channels.begin(), pImpl->channels.end(), channel) != pImpl->channels.end();
+        }
+
+        void SpectralAnalyzer::process(const Sensor::SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            for (Sensor::ChannelId channel : pImpl->channels) {
+                if (channel >= batch.channelCount()) {
+                    continue;
+                }
+                Impl::Stream& s = pImpl->stream(batch.device_id, channel);
+                pImpl->feed(s, batch.column(channel).data(), batch.timestamps_ns.data(), batch.size());
+            }
+        }
+
+        bool SpectralAnalyzer::getSpectrum(uint32_t device_id, Sensor::ChannelId channel,
+                                           std::vector<float>& magnitudes, double& bin_hz) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::Stream* s = pImpl->findStream(device_id, channel);
+            if (!s || !s->dft.isReady()) {
+                return false;
+            }
+            magnitudes.resize(pImpl->binCount());
+            s->dft.getMagnitudes(magnitudes.data(), pImpl->config.hann);
+
+            bin_hz = 0.0;
+            if (s->mean_interval_ns > 0.0) {
+                double sample_rate = Time::kNanosPerSecond / (s->mean_interval_ns * pImpl->config.decimation);
+                bin_hz = sample_rate / static_cast<double>(pImpl->config.window);
+            }
+            return true;
+        }
+
+        bool SpectralAnalyzer::getSpectrogram(uint32_t device_id, Sensor::ChannelId channel,
+                                              std::vector<float>& values, size_t& rows, size_t& cols) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            const Impl::Stream* s = pImpl->findStream(device_id, channel);
+            if (!s || s->column_count == 0) {
+                rows = cols = 0;
+                return false;
+            }
+            const size_t bins = pImpl->binCount();
+            const size_t capacity = pImpl->config.spectrogram_columns;
+            rows = bins;
+            cols = s->column_count;
+            values.resize(rows * cols);
+
+            const size_t oldest = (s->column_head + capacity - cols) % capacity;
+            for (size_t c = 0; c < cols; ++c) {
+                const float* column = s->spectrogram.data() + ((oldest + c) % capacity) * bins;
+                for (size_t r = 0; r < rows; ++r) {
+                    values[r * cols + c] = column[bins - 1 - r];
+                }
+            }
+            return true;
+        }
+
+        size_t SpectralAnalyzer::getBinCount() const {
+            return pImpl->binCount();
+        }
+
+        const SpectralConfig& SpectralAnalyzer::getConfig() const {
+            return pImpl->config;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
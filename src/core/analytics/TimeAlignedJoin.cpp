@@ -0,0 +1,201 @@
+#include "core/analytics/TimeAlignedJoin.h"
+#include "core/analytics/Resampler.h"
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+            constexpr int64_t kNoWatermark = std::numeric_limits<int64_t>::min();
+
+            /// @brief 아직 완성되지 않은 격자 프레임
+            struct PendingFrame {
+                std::vector<float> values;      // [stream][channel]
+                std::vector<uint8_t> present;   // [stream]
+            };
+        }
+
+        void AlignedBatch::clear() {
+            timestamps_ns.clear();
+            values.clear();
+            present.clear();
+        }
+
+        /// @brief TimeAlignedJoin 구현 클래스 (Pimpl 패턴)
+        class TimeAlignedJoin::Impl {
+        public:
+            JoinConfig config;
+            std::vector<uint32_t> device_ids;
+            std::unordered_map<uint32_t, size_t> stream_index;
+            std::vector<int64_t> stream_watermarks;   // 스트림별 마지막 격자 인덱스
+
+            bool has_base = false;
+            int64_t base = 0;                          // pending.front()의 격자 인덱스
+            std::deque<PendingFrame> pending;
+            std::vector<PendingFrame> free_frames;     // 할당 재사용
+            Time::Timestamp watermark = 0;
+            uint64_t late_samples = 0;
+            uint64_t skipped_frames = 0;
+
+            explicit Impl(const JoinConfig& cfg) : config(cfg) {
+                if (config.period <= 0) {
+                    config.period = Time::kNanosPerSecond;
+                }
+                if (config.max_buffered_frames == 0) {
+                    config.max_buffered_frames = 1;
+                }
+            }
+
+            PendingFrame takeFrame() {
+                PendingFrame frame;
+                if (!free_frames.empty()) {
+                    frame = std::move(free_frames.back());
+                    free_frames.pop_back();
+                }
+                frame.values.assign(device_ids.size() * config.channels, kNaN);
+                frame.present.assign(device_ids.size(), 0);
+                return frame;
+            }
+
+            void emitFront(AlignedBatch& out) {
+                PendingFrame& frame = pending.front();
+                out.stream_count = device_ids.size();
+                out.channel_count = config.channels;
+                watermark = config.origin + base * config.period;
+                out.timestamps_ns.push_back(watermark);
+                out.values.insert(out.values.end(), frame.values.begin(), frame.values.end());
+                out.present.insert(out.present.end(), frame.present.begin(), frame.present.end());
+
+                free_frames.push_back(std::move(frame));
+                pending.pop_front();
+                ++base;
+            }
+
+            size_t emitReady(AlignedBatch& out) {
+                if (device_ids.empty() || !has_base) {
+                    return 0;
+                }
+                int64_t slowest = *std::min_element(stream_watermarks.begin(), stream_watermarks.end());
+                int64_t ready = slowest;
+                if (config.max_lateness > 0) {
+                    int64_t leading = *std::max_element(stream_watermarks.begin(), stream_watermarks.end());
+                    // 한 주기보다 짧은 허용치도 한 프레임은 기다리도록 올림
+                    const int64_t lateness_frames = (config.max_lateness + config.period - 1) / config.period;
+                    ready = std::max(ready, leading - lateness_frames);
+                }
+
+                size_t emitted = 0;
+                while (!pending.empty() && base <= ready) {
+                    emitFront(out);
+                    ++emitted;
+                }
+                return emitted;
+            }
+        };
+
+        /// @brief TimeAlignedJoin 메서드 구현
+        TimeAlignedJoin::TimeAlignedJoin(const JoinConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        TimeAlignedJoin::~TimeAlignedJoin() = default;
+        TimeAlignedJoin::TimeAlignedJoin(TimeAlignedJoin&&) noexcept = default;
+        TimeAlignedJoin& TimeAlignedJoin::operator=(TimeAlignedJoin&&) noexcept = default;
+
+        size_t TimeAlignedJoin::addStream(uint32_t device_id) {
+            auto it = pImpl->stream_index.find(device_id);
+            if (it != pImpl->stream_index.end()) {
+                return it->second;
+            }
+            size_t index = pImpl->device_ids.size();
+            pImpl->device_ids.push_back(device_id);
+            pImpl->stream_index[device_id] = index;
+            pImpl->stream_watermarks.push_back(kNoWatermark);
+
+            // 대기 중인 프레임에 새 스트림 칸 추가 (스트림이 프레임 안의 바깥쪽 인덱스라 뒤에 붙이면 됨)
+            for (auto& frame : pImpl->pending) {
+                frame.values.resize(pImpl->device_ids.size() * pImpl->config.channels, kNaN);
+                frame.present.resize(pImpl->device_ids.size(), 0);
+            }
+            return index;
+        }
+
+        size_t TimeAlignedJoin::getStreamCount() const {
+            return pImpl->device_ids.size();
+        }
+
+        size_t TimeAlignedJoin::push(const Sensor::SensorBatch& resampled, AlignedBatch& out) {
+            auto it = pImpl->stream_index.find(resampled.device_id);
+            if (it == pImpl->stream_index.end()) {
+                return 0;
+            }
+            const size_t stream = it->second;
+            const size_t channels = pImpl->config.channels;
+            const size_t copy_channels = std::min(channels, resampled.channelCount());
+            size_t emitted = 0;
+
+            for (size_t i = 0; i < resampled.size(); ++i) {
+                int64_t k = gridIndex(resampled.timestamps_ns[i], pImpl->config.origin, pImpl->config.period);
+                if (!pImpl->has_base) {
+                    pImpl->has_base = true;
+                    pImpl->base = k;
+                }
+                if (k < pImpl->base) {
+                    pImpl->late_samples++;
+                    continue;
+                }
+                // 버퍼 상한: 프레임을 늘리기 전에 적용해 시각이 크게 건너뛰어도 빈 프레임을 만들지 않음.
+                // 창 밖으로 밀리는 대기 프레임은 빈 칸이 있어도 출력하고, 그 사이 빈 구간은 건너뜀
+                const int64_t max_frames = static_cast<int64_t>(pImpl->config.max_buffered_frames);
+                if (k - pImpl->base >= max_frames) {
+                    const int64_t new_base = k - max_frames + 1;
+                    while (!pImpl->pending.empty() && pImpl->base < new_base) {
+                        pImpl->emitFront(out);
+                        ++emitted;
+                    }
+                    if (pImpl->base < new_base) {
+                        pImpl->skipped_frames += static_cast<uint64_t>(new_base - pImpl->base);
+                        pImpl->base = new_base;
+                        pImpl->watermark = pImpl->config.origin + (new_base - 1) * pImpl->config.period;
+                    }
+                }
+                while (k >= pImpl->base + static_cast<int64_t>(pImpl->pending.size())) {
+                    pImpl->pending.push_back(pImpl->takeFrame());
+                }
+
+                PendingFrame& frame = pImpl->pending[static_cast<size_t>(k - pImpl->base)];
+                float* dst = frame.values.data() + stream * channels;
+                for (size_t ch = 0; ch < copy_channels; ++ch) {
+                    dst[ch] = resampled.columns[ch][i];
+                }
+                frame.present[stream] = 1;
+                pImpl->stream_watermarks[stream] = std::max(pImpl->stream_watermarks[stream], k);
+            }
+
+            return emitted + pImpl->emitReady(out);
+        }
+
+        size_t TimeAlignedJoin::flush(AlignedBatch& out) {
+            size_t emitted = 0;
+            while (!pImpl->pending.empty()) {
+                pImpl->emitFront(out);
+                ++emitted;
+            }
+            return emitted;
+        }
+
+        Time::Timestamp TimeAlignedJoin::getWatermark() const {
+            return pImpl->watermark;
+        }
+
+        uint64_t TimeAlignedJoin::getLateSampleCount() const {
+            return pImpl->late_samples;
+        }
+
+        uint64_t TimeAlignedJoin::getSkippedFrameCount() const {
+            return pImpl->skipped_frames;
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
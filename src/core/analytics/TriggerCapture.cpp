@@ -0,0 +1,304 @@
+#include "core/analytics/TriggerCapture.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Analytics {
+
+        namespace {
+            constexpr size_t kMaxArmedTriggers = 64;
+
+            /// @brief 발동 대기 중인 트리거
+            struct TriggerRequest {
+                TriggerSource source;
+                uint32_t device_id;
+                Time::Timestamp at;
+            };
+        }
+
+        const char* triggerSourceName(TriggerSource source) {
+            switch (source) {
+            case TriggerSource::MANUAL:      return "manual";
+            case TriggerSource::ALERT:       return "alert";
+            case TriggerSource::MOTION_EDGE: return "motion_edge";
+            default:                         return "unknown";
+            }
+        }
+
+        /// @brief TriggerCapture 구현 클래스 (Pimpl 패턴)
+        class TriggerCapture::Impl {
+        public:
+            /// @brief 디바이스 하나의 트리거 전 링 (수집 스레드 전용)
+            struct DeviceRing {
+                std::vector<Time::Timestamp> timestamps;
+                std::vector<std::vector<float>> columns;   // [channel][slot]
+                size_t mask = 0;                           // 링 크기 - 1
+                uint64_t written = 0;
+                bool motion = false;
+
+                bool capturing = false;
+                Time::Timestamp capture_end = 0;
+                Capture capture;
+            };
+
+            CaptureConfig config;
+            std::unordered_map<uint32_t, DeviceRing> rings;
+            std::vector<TriggerRequest> armed;             // 수집 스레드 전용
+            uint64_t next_capture_id = 1;
+
+            // 다른 스레드 -> 수집 스레드 트리거 전달 (대기 건수가 0이면 잠금을 건드리지 않음)
+            std::mutex request_mutex;
+            std::vector<TriggerRequest> requests;
+            std::atomic<size_t> request_count{0};
+
+            std::mutex completed_mutex;
+            std::deque<Capture> completed;
+            std::atomic<size_t> active{0};
+            std::atomic<uint64_t> ignored{0};
+            std::atomic<bool> motion_trigger{false};
+
+            explicit Impl(const CaptureConfig& cfg) : config(cfg) {
+                size_t capacity = 1;
+                while (capacity < std::max<size_t>(config.ring_capacity, 2)) {
+                    capacity <<= 1;
+                }
+                config.ring_capacity = capacity;
+                config.max_ring_capacity = std::max(config.max_ring_capacity, capacity);
+                config.max_completed = std::max<size_t>(config.max_completed, 1);
+                motion_trigger.store(config.trigger_on_motion_edge, std::memory_order_relaxed);
+            }
+
+            DeviceRing& ring(uint32_t device_id, size_t channels) {
+                DeviceRing& r = rings[device_id];
+                if (r.timestamps.empty()) {
+                    r.timestamps.assign(config.ring_capacity, 0);
+                    r.mask = config.ring_capacity - 1;
+                }
+                while (r.columns.size() < channels) {
+                    r.columns.emplace_back(r.timestamps.size(), std::nanf(""));
+                }
+                return r;
+            }
+
+            /// @brief 링 크기를 두 배로 (시퀀스 번호는 그대로, 보관 중인 샘플을 새 슬롯으로 옮김)
+            void grow(DeviceRing& r) {
+                const size_t old_capacity = r.timestamps.size();
+                const size_t capacity = old_capacity * 2;
+                const size_t new_mask = capacity - 1;
+                const uint64_t first = r.written > old_capacity ? r.written - old_capacity : 0;
+                std::vector<Time::Timestamp> timestamps(capacity, 0);
+                for (uint64_t seq = first; seq < r.written; ++seq) {
+                    timestamps[seq & new_mask] = r.timestamps[seq & r.mask];
+                }
+                r.timestamps.swap(timestamps);
+                for (auto& column : r.columns) {
+                    std::vector<float> grown(capacity, std::nanf(""));
+                    for (uint64_t seq = first; seq < r.written; ++seq) {
+                        grown[seq & new_mask] = column[seq & r.mask];
+                    }
+                    column.swap(grown);
+                }
+                r.mask = new_mask;
+            }
+
+            void collectRequests() {
+                if (request_count.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(request_mutex);
+                armed.insert(armed.end(), requests.begin(), requests.end());
+                requests.clear();
+                request_count.store(0, std::memory_order_release);
+                if (armed.size() > kMaxArmedTriggers) {
+                    armed.erase(armed.begin(), armed.end() - kMaxArmedTriggers);
+                }
+            }
+
+            /// @brief 링에서 [at - pre, 최신] 구간을 복사해 캡처 시작
+            void open(DeviceRing& r, uint32_t device_id, TriggerSource source, Time::Timestamp at) {
+                if (r.capturing) {
+                    ignored.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                Capture& c = r.capture;
+                c = Capture();
+                c.id = next_capture_id++;
+                c.device_id = device_id;
+                c.source = source;
+                c.trigger_ns = at;
+                c.columns.resize(r.columns.size());
+
+                const size_t mask = r.mask;
+                const uint64_t available = std::min<uint64_t>(r.written, r.timestamps.size());
+                const Time::Timestamp pre_start = at - config.pre_trigger_ns;
+                uint64_t first = r.written - available;
+                while (first < r.written && r.timestamps[first & mask] < pre_start) {
+                    ++first;
+                }
+                // 덮어써진 샘플이 있고 남은 가장 오래된 샘플도 구간 안이면 앞부분이 빠진 것
+                c.truncated = available < r.written && first == r.written - available &&
+                              first < r.written && r.timestamps[first & mask] > pre_start;
+                const size_t count = static_cast<size_t>(r.written - first);
+                c.timestamps_ns.reserve(count);
+                for (auto& column : c.columns) {
+                    column.reserve(count);
+                }
+                c.trigger_index = count;
+                for (uint64_t seq = first; seq < r.written; ++seq) {
+                    const size_t slot = static_cast<size_t>(seq & mask);
+                    if (c.trigger_index == count && r.timestamps[slot] >= at) {
+                        c.trigger_index = c.timestamps_ns.size();
+                    }
+                    c.timestamps_ns.push_back(r.timestamps[slot]);
+                    for (size_t ch = 0; ch < r.columns.size(); ++ch) {
+                        c.columns[ch].push_back(r.columns[ch][slot]);
+                    }
+                }
+
+                r.capturing = true;
+                r.capture_end = at + config.post_trigger_ns;
+                active.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void complete(DeviceRing& r) {
+                r.capturing = false;
+                active.fetch_sub(1, std::memory_order_relaxed);
+                std::lock_guard<std::mutex> lock(completed_mutex);
+                completed.push_back(std::move(r.capture));
+                if (completed.size() > config.max_completed) {
+                    completed.pop_front();
+                }
+            }
+        };
+
+        /// @brief TriggerCapture 메서드 구현
+        TriggerCapture::TriggerCapture(const CaptureConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        TriggerCapture::~TriggerCapture() = default;
+        TriggerCapture::TriggerCapture(TriggerCapture&&) noexcept = default;
+        TriggerCapture& TriggerCapture::operator=(TriggerCapture&&) noexcept = default;
+
+        void TriggerCapture::process(const Sensor::SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            pImpl->collectRequests();
+            Impl::DeviceRing& r = pImpl->ring(batch.device_id, batch.channelCount());
+            const size_t channels = batch.channelCount();
+            const Sensor::ChannelId motion = Sensor::toChannelId(Sensor::SensorChannel::MOTION);
+            auto& armed = pImpl->armed;
+            const bool motion_trigger = pImpl->motion_trigger.load(std::memory_order_relaxed);
+            const CaptureConfig& config = pImpl->config;
+
+            for (size_t i = 0; i < batch.size(); ++i) {
+                const Time::Timestamp t = batch.timestamps_ns[i];
+                // 덮어쓸 샘플이 아직 트리거 전 구간 안이면 링이 작은 것
+                if (r.written >= r.timestamps.size() && r.timestamps.size() < config.max_ring_capacity &&
+                    r.timestamps[r.written & r.mask] >= t - config.pre_trigger_ns) {
+                    pImpl->grow(r);
+                }
+                const size_t slot = static_cast<size_t>(r.written & r.mask);
+                r.timestamps[slot] = t;
+                for (size_t ch = 0; ch < r.columns.size(); ++ch) {
+                    r.columns[ch][slot] = ch < channels ? batch.columns[ch][i] : std::nanf("");
+                }
+                r.written++;
+
+                if (r.capturing) {
+                    Capture& c = r.capture;
+                    c.timestamps_ns.push_back(t);
+                    for (size_t ch = 0; ch < c.columns.size(); ++ch) {
+                        c.columns[ch].push_back(ch < channels ? batch.columns[ch][i] : std::nanf(""));
+                    }
+                }
+
+                // 이 샘플까지 시각이 지난 대기 트리거 발동 (캡처 중이면 open이 무시 횟수만 센다)
+                for (auto it = armed.begin(); it != armed.end();) {
+                    if (it->device_id == batch.device_id && it->at <= t) {
+                        pImpl->open(r, it->device_id, it->source, it->at);
+                        it = armed.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+
+                // 캡처 중에도 모션 상태는 계속 따라가야 캡처가 끝난 뒤 지난 상승 에지로 발동하지 않는다
+                if (motion < channels) {
+                    const bool moving = batch.columns[motion][i] >= 0.5f;
+                    if (motion_trigger && moving && !r.motion) {
+                        pImpl->open(r, batch.device_id, TriggerSource::MOTION_EDGE, t);
+                    }
+                    r.motion = moving;
+                }
+
+                if (r.capturing && t >= r.capture_end) {
+                    pImpl->complete(r);
+                }
+            }
+        }
+
+        void TriggerCapture::trigger(TriggerSource source, uint32_t device_id, Time::Timestamp at) {
+            std::lock_guard<std::mutex> lock(pImpl->request_mutex);
+            pImpl->requests.push_back({source, device_id, at});
+            pImpl->request_count.store(pImpl->requests.size(), std::memory_order_release);
+        }
+
+        void TriggerCapture::setMotionTrigger(bool enabled) {
+            pImpl->motion_trigger.store(enabled, std::memory_order_relaxed);
+        }
+
+        bool TriggerCapture::getMotionTrigger() const {
+            return pImpl->motion_trigger.load(std::memory_order_relaxed);
+        }
+
+        size_t TriggerCapture::takeCompleted(std::vector<Capture>& out) {
+            std::lock_guard<std::mutex> lock(pImpl->completed_mutex);
+            size_t taken = pImpl->completed.size();
+            for (auto& capture : pImpl->completed) {
+                out.push_back(std::move(capture));
+            }
+            pImpl->completed.clear();
+            return taken;
+        }
+
+        size_t TriggerCapture::getActiveCount() const {
+            return pImpl->active.load(std::memory_order_relaxed);
+        }
+
+        uint64_t TriggerCapture::getIgnoredTriggerCount() const {
+            return pImpl->ignored.load(std::memory_order_relaxed);
+        }
+
+        const CaptureConfig& TriggerCapture::getConfig() const {
+            return pImpl->config;
+        }
+
+        bool writeCaptureCsv(const Capture& capture, const std::string& path, const Sensor::ChannelRegistry* names) {
+            std::ofstream file(path);
+            if (!file) {
+                return false;
+            }
+            file << "# device=" << capture.device_id << " source=" << triggerSourceName(capture.source)
+                 << " trigger_ns=" << capture.trigger_ns << (capture.truncated ? " truncated=1" : "") << "\n";
+            file << "t";
+            for (size_t ch = 0; ch < capture.columns.size(); ++ch) {
+                auto id = static_cast<Sensor::ChannelId>(ch);
+                file << "," << (names && ch < names->size() ? names->getName(id).c_str() : Sensor::channelName(id));
+            }
+            file << "\n";
+            for (size_t i = 0; i < capture.timestamps_ns.size(); ++i) {
+                file << Time::toSeconds(capture.timestamps_ns[i] - capture.trigger_ns);
+                for (const auto& column : capture.columns) {
+                    file << "," << column[i];
+                }
+                file << "\n";
+            }
+            return static_cast<bool>(file);
+        }
+
+    } // namespace Analytics
+} // namespace DachshundEngine
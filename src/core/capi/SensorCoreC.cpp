@@ -0,0 +1,656 @@
+#include "core/capi/SensorCoreC.h"
+#include "core/sensor/SensorManager.h"
+#include "core/sensor/SensorBatch.h"
+#include "core/sensor/SensorSource.h"
+#include "core/sensor/HostSource.h"
+#include "core/sensor/SerialSource.h"
+#include "core/sensor/MqttSource.h"
+#include "core/alert/AlertEngine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace DachshundEngine;
+
+namespace {
+    thread_local std::string last_error;
+
+    /// @brief 예외가 C 경계를 넘지 않도록 감쌈
+    template <typename Function>
+    dsh_status guarded(Function&& function) {
+        try {
+            return function();
+        } catch (const std::exception& e) {
+            last_error = e.what();
+        } catch (...) {
+            last_error = "unknown exception";
+        }
+        return DSH_ERR_FAILED;
+    }
+
+    dsh_status invalid(const char* message) {
+        last_error = message;
+        return DSH_ERR_INVALID_ARGUMENT;
+    }
+
+    bool toMode(dsh_mode mode, Sensor::SensorMode& out) {
+        switch (mode) {
+        case DSH_MODE_MOCK:         out = Sensor::SensorMode::MOCK_DATA; return true;
+        case DSH_MODE_RASPBERRY_PI: out = Sensor::SensorMode::RASPBERRY_PI; return true;
+        default:                    return false;
+        }
+    }
+
+    using ConfigEntries = std::vector<std::pair<std::string, std::string>>;
+
+    std::string trim(const std::string& text) {
+        const size_t begin = text.find_first_not_of(" \t");
+        if (begin == std::string::npos) {
+            return std::string();
+        }
+        const size_t end = text.find_last_not_of(" \t");
+        return text.substr(begin, end - begin + 1);
+    }
+
+    /// @brief "key=value;key=value" 설정 문자열 분해 (값에는 ';'를 쓸 수 없음, 같은 키 반복 가능)
+    bool parseConfig(const char* text, ConfigEntries& out) {
+        if (!text) {
+            return true;
+        }
+        const std::string config(text);
+        size_t pos = 0;
+        while (pos <= config.size()) {
+            size_t end = config.find(';', pos);
+            if (end == std::string::npos) {
+                end = config.size();
+            }
+            const std::string item = trim(config.substr(pos, end - pos));
+            pos = end + 1;
+            if (item.empty()) {
+                continue;
+            }
+            const size_t eq = item.find('=');
+            if (eq == std::string::npos || eq == 0) {
+                last_error = "config entry '" + item + "' is not key=value";
+                return false;
+            }
+            out.emplace_back(trim(item.substr(0, eq)), trim(item.substr(eq + 1)));
+        }
+        return true;
+    }
+
+    bool toNumber(const std::string& key, const std::string& text, double& out) {
+        char* end = nullptr;
+        out = std::strtod(text.c_str(), &end);
+        if (text.empty() || *end != '\0' || !std::isfinite(out)) {
+            last_error = "'" + key + "' needs a number, got '" + text + "'";
+            return false;
+        }
+        return true;
+    }
+
+    bool toInteger(const std::string& key, const std::string& text, long minimum, long maximum, long& out) {
+        char* end = nullptr;
+        out = std::strtol(text.c_str(), &end, 10);
+        if (text.empty() || *end != '\0' || out < minimum || out > maximum) {
+            last_error = "'" + key + "' needs an integer " + std::to_string(minimum) + " to " +
+                         std::to_string(maximum) + ", got '" + text + "'";
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief 채널 이름 또는 번호
+    bool toChannel(const Sensor::ChannelRegistry& registry, const std::string& text, Sensor::ChannelId& out) {
+        if (registry.find(text, out)) {
+            return true;
+        }
+        long number = 0;
+        if (toInteger("channel", text, 0, static_cast<long>(registry.size()) - 1, number)) {
+            out = static_cast<Sensor::ChannelId>(number);
+            return true;
+        }
+        last_error = "unknown channel '" + text + "'";
+        return false;
+    }
+
+    dsh_status unknownKey(const char* type, const std::string& key) {
+        last_error = "unknown key '" + key + "' for " + type + " source";
+        return DSH_ERR_INVALID_ARGUMENT;
+    }
+
+    dsh_status makeHostSource(const ConfigEntries& entries, std::unique_ptr<Sensor::SensorSource>& out) {
+        Sensor::HostSourceConfig config;
+        for (const auto& [key, value] : entries) {
+            double number = 0.0;
+            if (key == "sample_rate_hz") {
+                if (!toNumber(key, value, number) || number <= 0.0) {
+                    last_error = "'sample_rate_hz' must be positive";
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.sample_rate_hz = static_cast<float>(number);
+            } else if (key == "hwmon_root") {
+                config.hwmon_root = value;
+            } else if (key == "proc_root") {
+                config.proc_root = value;
+            } else if (key == "hwmon_name") {
+                config.hwmon_name = value;
+            } else {
+                return unknownKey("host", key);
+            }
+        }
+        out = std::make_unique<Sensor::HostSource>(config);
+        return DSH_OK;
+    }
+
+    dsh_status makeSerialSource(const ConfigEntries& entries, const Sensor::ChannelRegistry& registry,
+                                std::unique_ptr<Sensor::SensorSource>& out) {
+        Sensor::SerialSourceConfig config;
+        for (const auto& [key, value] : entries) {
+            long number = 0;
+            if (key == "device") {
+                config.device = value;
+            } else if (key == "baud") {
+                if (!toInteger(key, value, 1, 4000000, number)) {
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.baud = static_cast<int>(number);
+            } else if (key == "framing") {
+                if (value == "line") {
+                    config.framing.framing = Sensor::SerialFraming::LINE;
+                } else if (value == "binary") {
+                    config.framing.framing = Sensor::SerialFraming::BINARY;
+                } else {
+                    last_error = "'framing' must be line or binary";
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+            } else if (key == "delimiter") {
+                if (value.size() != 1) {
+                    last_error = "'delimiter' must be one character";
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.framing.delimiter = value[0];
+            } else if (key == "fields") {
+                // 필드 순서대로 채널 이름 또는 번호 (쉼표 구분)
+                config.framing.fields.clear();
+                size_t pos = 0;
+                while (pos <= value.size()) {
+                    size_t end = value.find(',', pos);
+                    if (end == std::string::npos) {
+                        end = value.size();
+                    }
+                    Sensor::ChannelId channel = 0;
+                    if (!toChannel(registry, trim(value.substr(pos, end - pos)), channel)) {
+                        return DSH_ERR_INVALID_ARGUMENT;
+                    }
+                    config.framing.fields.push_back(channel);
+                    pos = end + 1;
+                }
+            } else {
+                return unknownKey("serial", key);
+            }
+        }
+        out = std::make_unique<Sensor::SerialSource>(config);
+        return DSH_OK;
+    }
+
+    dsh_status makeMqttSource(const ConfigEntries& entries, const Sensor::ChannelRegistry& registry,
+                              uint32_t device_id, std::unique_ptr<Sensor::SensorSource>& out) {
+        Sensor::MqttSourceConfig config;
+        for (const auto& [key, value] : entries) {
+            long number = 0;
+            if (key == "host") {
+                config.host = value;
+            } else if (key == "port") {
+                if (!toInteger(key, value, 1, 65535, number)) {
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.port = static_cast<int>(number);
+            } else if (key == "client_id") {
+                config.client_id = value;
+            } else if (key == "username") {
+                config.username = value;
+            } else if (key == "password") {
+                config.password = value;
+            } else if (key == "keep_alive_s") {
+                if (!toInteger(key, value, 0, 65535, number)) {
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.keep_alive_s = static_cast<uint16_t>(number);
+            } else if (key == "qos") {
+                if (!toInteger(key, value, 0, 1, number)) {
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.qos = static_cast<uint8_t>(number);
+            } else if (key == "route") {
+                // <토픽>><채널>[@<디바이스 ID 토픽 단계>] (단계가 없으면 add_source의 device_id)
+                const size_t arrow = value.rfind('>');
+                if (arrow == std::string::npos || arrow == 0) {
+                    last_error = "'route' must be <topic>><channel>[@<level>], got '" + value + "'";
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                Sensor::MqttRoute route;
+                route.topic = trim(value.substr(0, arrow));
+                route.device_id = device_id;
+                std::string channel = trim(value.substr(arrow + 1));
+                const size_t at = channel.find('@');
+                if (at != std::string::npos) {
+                    if (!toInteger("route level", trim(channel.substr(at + 1)), 0, 255, number)) {
+                        return DSH_ERR_INVALID_ARGUMENT;
+                    }
+                    route.device_level = static_cast<int>(number);
+                    channel = trim(channel.substr(0, at));
+                }
+                if (!toChannel(registry, channel, route.channel)) {
+                    return DSH_ERR_INVALID_ARGUMENT;
+                }
+                config.routes.push_back(std::move(route));
+            } else {
+                return unknownKey("mqtt", key);
+            }
+        }
+        if (config.routes.empty()) {
+            last_error = "mqtt source needs at least one 'route'";
+            return DSH_ERR_INVALID_ARGUMENT;
+        }
+        out = std::make_unique<Sensor::MqttSource>(config);
+        return DSH_OK;
+    }
+
+    /// @brief 배치 콜백 하나 (열 포인터 배열은 재사용)
+    struct BatchCallback {
+        uint32_t id = 0;
+        size_t processor_id = 0;
+        dsh_batch_callback callback = nullptr;
+        void* user_data = nullptr;
+        std::vector<const float*> columns;
+    };
+}
+
+/// @brief C 핸들 (매니저를 마지막 멤버로 두어 콜백이 참조하는 멤버보다 먼저 파괴)
+struct dsh_manager {
+    // 일괄 읽기 큐 (행 우선 고정 크기 링, 수집 스레드와 읽는 스레드 사이는 queue_mutex)
+    std::mutex queue_mutex;
+    std::vector<dsh_sample_info> queue_infos;
+    std::vector<float> queue_values;
+    size_t queue_stride = 0;
+    size_t queue_head = 0;
+    size_t queue_size = 0;
+    uint64_t queue_dropped = 0;
+    size_t queue_processor = 0;
+    bool queue_enabled = false;
+
+    std::list<BatchCallback> batch_callbacks;
+    uint32_t next_callback_id = 1;
+
+    Sensor::SensorDataManager manager;
+
+    explicit dsh_manager(Sensor::SensorMode mode) : manager(mode) {}
+
+    void enqueue(const Sensor::SensorBatch& batch) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        const size_t capacity = queue_infos.size();
+        const size_t channels = std::min(batch.channelCount(), queue_stride);
+        const float nan = std::nanf("");
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (queue_size == capacity) {
+                queue_head = (queue_head + 1) % capacity;   // 가장 오래된 샘플 버림
+                queue_size--;
+                queue_dropped++;
+            }
+            const size_t slot = (queue_head + queue_size) % capacity;
+            dsh_sample_info& info = queue_infos[slot];
+            info.timestamp_ns = batch.timestamps_ns[i];
+            info.device_id = batch.device_id;
+            info.quality = i < batch.quality.size() ? batch.quality[i] : 0;
+            float* values = queue_values.data() + slot * queue_stride;
+            for (size_t ch = 0; ch < channels; ++ch) {
+                values[ch] = batch.columns[ch][i];
+            }
+            std::fill(values + channels, values + queue_stride, nan);
+            queue_size++;
+        }
+    }
+};
+
+extern "C" {
+
+DSH_API uint32_t dsh_abi_version(void) {
+    return DSH_ABI_VERSION;
+}
+
+DSH_API const char* dsh_last_error(void) {
+    return last_error.c_str();
+}
+
+DSH_API dsh_manager* dsh_manager_create(dsh_mode mode) {
+    Sensor::SensorMode sensor_mode;
+    if (!toMode(mode, sensor_mode)) {
+        last_error = "unknown mode";
+        return nullptr;
+    }
+    try {
+        return new dsh_manager(sensor_mode);
+    } catch (const std::exception& e) {
+        last_error = e.what();
+    } catch (...) {
+        last_error = "unknown exception";
+    }
+    return nullptr;
+}
+
+DSH_API void dsh_manager_destroy(dsh_manager* manager) {
+    if (!manager) {
+        return;
+    }
+    manager->manager.stopSampling();
+    delete manager;
+}
+
+DSH_API dsh_status dsh_manager_set_mode(dsh_manager* manager, dsh_mode mode) {
+    Sensor::SensorMode sensor_mode;
+    if (!manager || !toMode(mode, sensor_mode)) {
+        return invalid("invalid manager or mode");
+    }
+    return guarded([&] {
+        manager->manager.setMode(sensor_mode);
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_connect(dsh_manager* manager, const char* host, int port) {
+    if (!manager || !host || port <= 0 || port > 65535) {
+        return invalid("invalid manager, host or port");
+    }
+    return guarded([&] {
+        if (!manager->manager.connectToRaspberryPi(host, port)) {
+            last_error = std::string("cannot connect to ") + host + ":" + std::to_string(port);
+            return DSH_ERR_FAILED;
+        }
+        return DSH_OK;
+    });
+}
+
+DSH_API void dsh_manager_disconnect(dsh_manager* manager) {
+    if (manager) {
+        manager->manager.disconnect();
+    }
+}
+
+DSH_API int dsh_manager_is_connected(dsh_manager* manager) {
+    return manager && manager->manager.isConnected() ? 1 : 0;
+}
+
+DSH_API dsh_status dsh_manager_set_update_interval(dsh_manager* manager, float milliseconds) {
+    if (!manager || !(milliseconds > 0.0f)) {
+        return invalid("update interval must be positive");
+    }
+    return guarded([&] {
+        manager->manager.setUpdateInterval(milliseconds);
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_start_sampling(dsh_manager* manager) {
+    if (!manager) {
+        return invalid("null manager");
+    }
+    return guarded([&] {
+        manager->manager.startSampling();
+        return DSH_OK;
+    });
+}
+
+DSH_API void dsh_manager_stop_sampling(dsh_manager* manager) {
+    if (manager) {
+        manager->manager.stopSampling();
+    }
+}
+
+DSH_API dsh_status dsh_manager_poll(dsh_manager* manager) {
+    if (!manager) {
+        return invalid("null manager");
+    }
+    return guarded([&] {
+        manager->manager.getCurrentSensorData();    // 주기가 됐으면 수집/파이프라인 실행
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_add_source(dsh_manager* manager, const char* type, uint32_t device_id,
+                                          uint32_t* out_source_id) {
+    return dsh_manager_add_source_config(manager, type, device_id, nullptr, out_source_id);
+}
+
+DSH_API dsh_status dsh_manager_add_source_config(dsh_manager* manager, const char* type, uint32_t device_id,
+                                                 const char* config, uint32_t* out_source_id) {
+    if (!manager || !type) {
+        return invalid("invalid manager or source type");
+    }
+    return guarded([&] {
+        ConfigEntries entries;
+        if (!parseConfig(config, entries)) {
+            return DSH_ERR_INVALID_ARGUMENT;
+        }
+        std::unique_ptr<Sensor::SensorSource> source;
+        const std::string kind(type);
+        dsh_status status = DSH_OK;
+        {
+            auto lock = manager->manager.lockPipeline();
+            const Sensor::ChannelRegistry& registry = manager->manager.getChannelRegistry();
+            if (kind == "host") {
+                status = makeHostSource(entries, source);
+            } else if (kind == "serial") {
+                status = makeSerialSource(entries, registry, source);
+            } else if (kind == "mqtt") {
+                status = makeMqttSource(entries, registry, device_id, source);
+            } else if (!entries.empty()) {
+                last_error = "source type '" + kind + "' takes no configuration";
+                status = DSH_ERR_INVALID_ARGUMENT;
+            }
+        }
+        if (status != DSH_OK) {
+            return status;
+        }
+        if (!source) {
+            source = Sensor::sourceRegistry().create(kind);
+        }
+        if (!source) {
+            last_error = "unknown source type '" + kind + "'";
+            return DSH_ERR_NOT_FOUND;
+        }
+        source->setDeviceId(device_id);
+        const Sensor::SourceId id = manager->manager.addSource(std::move(source));
+        if (id == Sensor::SensorDataManager::kInvalidSourceId) {
+            last_error = manager->manager.getLastSourceError();
+            return DSH_ERR_FAILED;
+        }
+        if (out_source_id) {
+            *out_source_id = id;
+        }
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_remove_source(dsh_manager* manager, uint32_t source_id) {
+    if (!manager) {
+        return invalid("null manager");
+    }
+    return guarded([&] {
+        if (!manager->manager.removeSource(source_id)) {
+            last_error = "no removable source " + std::to_string(source_id);
+            return DSH_ERR_NOT_FOUND;
+        }
+        return DSH_OK;
+    });
+}
+
+DSH_API uint32_t dsh_manager_channel_count(dsh_manager* manager) {
+    if (!manager) {
+        return 0;
+    }
+    auto lock = manager->manager.lockPipeline();
+    return static_cast<uint32_t>(manager->manager.getChannelRegistry().size());
+}
+
+DSH_API dsh_status dsh_manager_channel_name(dsh_manager* manager, uint32_t channel, char* buffer, size_t capacity) {
+    if (!manager || (!buffer && capacity > 0)) {
+        return invalid("invalid manager or buffer");
+    }
+    return guarded([&] {
+        auto lock = manager->manager.lockPipeline();
+        const Sensor::ChannelRegistry& registry = manager->manager.getChannelRegistry();
+        if (channel >= registry.size()) {
+            last_error = "no channel " + std::to_string(channel);
+            return DSH_ERR_NOT_FOUND;
+        }
+        const std::string& name = registry.getName(static_cast<Sensor::ChannelId>(channel));
+        if (capacity < name.size() + 1) {
+            last_error = "channel name needs " + std::to_string(name.size() + 1) + " bytes";
+            return DSH_ERR_BUFFER_TOO_SMALL;
+        }
+        std::memcpy(buffer, name.c_str(), name.size() + 1);
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_enable_queue(dsh_manager* manager, size_t capacity, uint32_t channel_count) {
+    if (!manager || capacity == 0 || channel_count == 0) {
+        return invalid("queue capacity and channel count must be positive");
+    }
+    return guarded([&] {
+        {
+            std::lock_guard<std::mutex> lock(manager->queue_mutex);
+            manager->queue_infos.assign(capacity, dsh_sample_info{});
+            manager->queue_values.assign(capacity * channel_count, 0.0f);
+            manager->queue_stride = channel_count;
+            manager->queue_head = 0;
+            manager->queue_size = 0;
+            manager->queue_dropped = 0;
+        }
+        if (!manager->queue_enabled) {
+            manager->queue_processor = manager->manager.addBatchProcessor(
+                [manager](const Sensor::SensorBatch& batch) { manager->enqueue(batch); });
+            manager->queue_enabled = true;
+        }
+        return DSH_OK;
+    });
+}
+
+DSH_API size_t dsh_manager_read_samples(dsh_manager* manager, dsh_sample_info* infos, float* values,
+                                        size_t max_samples) {
+    if (!manager) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(manager->queue_mutex);
+    const size_t count = std::min(max_samples, manager->queue_size);
+    const size_t capacity = manager->queue_infos.size();
+    const size_t stride = manager->queue_stride;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t slot = (manager->queue_head + i) % capacity;
+        if (infos) {
+            infos[i] = manager->queue_infos[slot];
+        }
+        if (values) {
+            std::memcpy(values + i * stride, manager->queue_values.data() + slot * stride, stride * sizeof(float));
+        }
+    }
+    if (count > 0) {
+        manager->queue_head = (manager->queue_head + count) % capacity;
+        manager->queue_size -= count;
+    }
+    return count;
+}
+
+DSH_API uint64_t dsh_manager_dropped_samples(dsh_manager* manager) {
+    if (!manager) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(manager->queue_mutex);
+    return manager->queue_dropped;
+}
+
+DSH_API dsh_status dsh_manager_add_batch_callback(dsh_manager* manager, dsh_batch_callback callback,
+                                                  void* user_data, uint32_t* out_callback_id) {
+    if (!manager || !callback) {
+        return invalid("invalid manager or callback");
+    }
+    return guarded([&] {
+        auto lock = manager->manager.lockPipeline();
+        BatchCallback& entry = manager->batch_callbacks.emplace_back();
+        entry.id = manager->next_callback_id++;
+        entry.callback = callback;
+        entry.user_data = user_data;
+        BatchCallback* target = &entry;
+        entry.processor_id = manager->manager.addBatchProcessor([target](const Sensor::SensorBatch& batch) {
+            target->columns.resize(batch.channelCount());
+            for (size_t ch = 0; ch < batch.channelCount(); ++ch) {
+                target->columns[ch] = batch.columns[ch].data();
+            }
+            dsh_batch_view view;
+            view.device_id = batch.device_id;
+            view.channel_count = static_cast<uint32_t>(batch.channelCount());
+            view.sample_count = batch.size();
+            view.timestamps_ns = batch.timestamps_ns.data();
+            view.quality = batch.quality.data();
+            view.columns = target->columns.data();
+            target->callback(target->user_data, &view);
+        });
+        if (out_callback_id) {
+            *out_callback_id = entry.id;
+        }
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_remove_batch_callback(dsh_manager* manager, uint32_t callback_id) {
+    if (!manager) {
+        return invalid("null manager");
+    }
+    return guarded([&] {
+        auto lock = manager->manager.lockPipeline();
+        auto& callbacks = manager->batch_callbacks;
+        auto it = std::find_if(callbacks.begin(), callbacks.end(),
+                               [callback_id](const BatchCallback& entry) { return entry.id == callback_id; });
+        if (it == callbacks.end()) {
+            last_error = "no batch callback " + std::to_string(callback_id);
+            return DSH_ERR_NOT_FOUND;
+        }
+        manager->manager.removeBatchProcessor(it->processor_id);
+        callbacks.erase(it);
+        return DSH_OK;
+    });
+}
+
+DSH_API dsh_status dsh_manager_set_alert_callback(dsh_manager* manager, dsh_alert_callback callback,
+                                                  void* user_data) {
+    if (!manager) {
+        return invalid("null manager");
+    }
+    return guarded([&] {
+        if (!callback) {
+            manager->manager.setOnAlert(nullptr);
+            return DSH_OK;
+        }
+        manager->manager.setOnAlert([callback, user_data](const Alert::AlertEvent& event) {
+            dsh_alert alert;
+            alert.rule_id = event.rule_id;
+            alert.device_id = event.device_id;
+            alert.channel = event.channel;
+            alert.raised = event.transition == Alert::AlertTransition::RAISED ? 1 : 0;
+            alert.severity = static_cast<uint8_t>(event.severity);
+            alert.value = event.value;
+            alert.timestamp_ns = event.timestamp_ns;
+            callback(user_data, &alert);
+        });
+        return DSH_OK;
+    });
+}
+
+} // extern "C"
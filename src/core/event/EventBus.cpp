@@ -0,0 +1,127 @@
+#include "core/event/EventBus.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace DachshundEngine {
+    namespace Event {
+
+        float SampleEvent::channel(Sensor::ChannelId id) const {
+            switch (static_cast<Sensor::SensorChannel>(id)) {
+            case Sensor::SensorChannel::TEMPERATURE:  return data.temperature;
+            case Sensor::SensorChannel::HUMIDITY:     return data.humidity;
+            case Sensor::SensorChannel::PRESSURE:     return data.pressure;
+            case Sensor::SensorChannel::LIGHT:        return data.light;
+            case Sensor::SensorChannel::MOTION:       return data.motion_detected ? 1.0f : 0.0f;
+            case Sensor::SensorChannel::CPU_USAGE:    return data.cpu_usage;
+            case Sensor::SensorChannel::MEMORY_USAGE: return data.memory_usage;
+            default: break;
+            }
+            size_t index = id - Sensor::kSensorChannelCount;
+            return index < extra_count ? extra[index] : std::nanf("");
+        }
+
+        BusEvent makeCommandEvent(const std::string& command, float value, uint32_t device_id) {
+            CommandEvent cmd;
+            cmd.device_id = device_id;
+            std::strncpy(cmd.command, command.c_str(), sizeof(cmd.command) - 1);
+            cmd.value = value;
+
+            BusEvent event;
+            event.payload = cmd;
+            return event;
+        }
+
+        /// @brief EventBus 메서드 구현
+        EventBus::EventBus(size_t capacity) {
+            slots_count = 1;
+            while (slots_count < capacity) {
+                slots_count <<= 1;
+            }
+            mask = slots_count - 1;
+            slots = std::make_unique<Slot[]>(slots_count);
+        }
+
+        EventBus::~EventBus() = default;
+
+        bool EventBus::publish(const BusEvent& event) {
+            const uint64_t seq = claim.fetch_add(1, std::memory_order_acq_rel);
+            Slot& slot = slots[seq & mask];
+            // 쓰는 동안 0으로 내려 두어 복사 중인 구독자가 시퀀스 재확인으로 알아채게 함
+            slot.sequence.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.event = event;
+            slot.sequence.store(seq + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool EventBus::skipLapped(Cursor& cursor, uint64_t& next) {
+            const uint64_t published = claim.load(std::memory_order_acquire);
+            if (published <= next + slots_count) {
+                return false;
+            }
+            const uint64_t oldest = published - slots_count;
+            cursor.missed.fetch_add(oldest - next, std::memory_order_relaxed);
+            dropped.fetch_add(oldest - next, std::memory_order_relaxed);
+            next = oldest;
+            return true;
+        }
+
+        SubscriberId EventBus::subscribe(const std::string& name) {
+            std::lock_guard<std::mutex> lock(subscriber_mutex);
+            for (SubscriberId id = 0; id < kMaxSubscribers; ++id) {
+                Cursor& cursor = cursors[id];
+                if (!cursor.active.load(std::memory_order_relaxed)) {
+                    cursor.name = name;
+                    cursor.missed.store(0, std::memory_order_relaxed);
+                    cursor.next.store(claim.load(std::memory_order_acquire), std::memory_order_relaxed);
+                    cursor.active.store(true, std::memory_order_release);
+                    return id;
+                }
+            }
+            return kInvalidSubscriber;
+        }
+
+        void EventBus::unsubscribe(SubscriberId id) {
+            if (id >= kMaxSubscribers) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(subscriber_mutex);
+            cursors[id].active.store(false, std::memory_order_release);
+            cursors[id].name.clear();
+        }
+
+        uint64_t EventBus::getLag(SubscriberId id) const {
+            if (id >= kMaxSubscribers || !cursors[id].active.load(std::memory_order_acquire)) {
+                return 0;
+            }
+            uint64_t published = claim.load(std::memory_order_acquire);
+            uint64_t next = cursors[id].next.load(std::memory_order_acquire);
+            return published > next ? std::min<uint64_t>(published - next, slots_count) : 0;
+        }
+
+        uint64_t EventBus::getPublishedCount() const {
+            return claim.load(std::memory_order_relaxed);
+        }
+
+        uint64_t EventBus::getDroppedCount() const {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+        uint64_t EventBus::getMissedCount(SubscriberId id) const {
+            if (id >= kMaxSubscribers || !cursors[id].active.load(std::memory_order_acquire)) {
+                return 0;
+            }
+            return cursors[id].missed.load(std::memory_order_relaxed);
+        }
+
+        std::string EventBus::getSubscriberName(SubscriberId id) const {
+            if (id >= kMaxSubscribers) {
+                return "";
+            }
+            std::lock_guard<std::mutex> lock(subscriber_mutex);
+            return cursors[id].name;
+        }
+
+    } // namespace Event
+} // namespace DachshundEngine
@@ -0,0 +1,461 @@
+#include "core/ipc/SharedRing.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace DachshundEngine {
+    namespace Ipc {
+
+        namespace {
+            constexpr size_t kAlignment = 64;
+            constexpr size_t kMaxChannels = 1024;
+            constexpr size_t kCursorPublishInterval = 64;      // 긴 poll 중에도 작성자가 지연을 볼 수 있도록
+
+            size_t alignUp(size_t value) {
+                return (value + kAlignment - 1) & ~(kAlignment - 1);
+            }
+
+            size_t roundUpPow2(size_t value) {
+                size_t result = 2;
+                while (result < value) {
+                    result <<= 1;
+                }
+                return result;
+            }
+
+            SharedRingSlotHeader* slotAt(uint8_t* base, const SharedRingHeader& header, uint64_t sequence) {
+                const uint64_t index = sequence & (header.slot_count - 1);
+                return reinterpret_cast<SharedRingSlotHeader*>(base + header.slots_offset + index * header.slot_bytes);
+            }
+
+            float* slotValues(SharedRingSlotHeader* slot) {
+                return reinterpret_cast<float*>(slot + 1);
+            }
+
+            char* nameAt(uint8_t* base, const SharedRingHeader& header, size_t channel) {
+                return reinterpret_cast<char*>(base + header.names_offset + channel * kSharedRingNameBytes);
+            }
+
+            void copyName(char* out, const std::string& name) {
+                const size_t length = std::min(name.size(), kSharedRingNameBytes - 1);
+                std::memcpy(out, name.data(), length);
+                std::memset(out + length, 0, kSharedRingNameBytes - length);
+            }
+
+#ifndef _WIN32
+            bool processAlive(int32_t pid) {
+                return pid > 0 && (::kill(pid, 0) == 0 || errno == EPERM);
+            }
+#endif
+        }
+
+        /// @brief SharedRingWriter 구현 클래스 (Pimpl 패턴)
+        class SharedRingWriter::Impl {
+        public:
+            SharedRingConfig config;
+            std::string last_error;
+            uint8_t* base = nullptr;
+            size_t mapped_bytes = 0;
+            SharedRingHeader* header = nullptr;
+
+            ~Impl() {
+                close();
+            }
+
+            void close() {
+#ifndef _WIN32
+                if (base) {
+                    header->writer_pid.store(0, std::memory_order_release);
+                    ::munmap(base, mapped_bytes);
+                    ::shm_unlink(config.name.c_str());
+                }
+#endif
+                base = nullptr;
+                header = nullptr;
+                mapped_bytes = 0;
+            }
+        };
+
+        /// @brief SharedRingWriter 메서드 구현
+        SharedRingWriter::SharedRingWriter() : pImpl(std::make_unique<Impl>()) {}
+        SharedRingWriter::~SharedRingWriter() = default;
+
+        bool SharedRingWriter::open(const SharedRingConfig& config) {
+            Impl& impl = *pImpl;
+            impl.close();
+            impl.config = config;
+            impl.config.slot_count = roundUpPow2(std::max<size_t>(config.slot_count, 2));
+            impl.config.channel_count = std::clamp<size_t>(config.channel_count, 1, kMaxChannels);
+#ifdef _WIN32
+            impl.last_error = "shared memory export is only available on POSIX systems";
+            return false;
+#else
+            if (impl.config.name.size() < 2 || impl.config.name[0] != '/') {
+                impl.last_error = "shared memory name must start with '/'";
+                return false;
+            }
+            const size_t channels = impl.config.channel_count;
+            const size_t names_offset = sizeof(SharedRingHeader);
+            const size_t slots_offset = alignUp(names_offset + channels * kSharedRingNameBytes);
+            const size_t slot_bytes = alignUp(sizeof(SharedRingSlotHeader) + channels * sizeof(float));
+            const size_t total = slots_offset + impl.config.slot_count * slot_bytes;
+
+            // 이전 실행이 남긴 세그먼트는 크기/버전이 다를 수 있으므로 새로 만든다
+            ::shm_unlink(impl.config.name.c_str());
+            const int fd = ::shm_open(impl.config.name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC,
+                                      static_cast<mode_t>(impl.config.permissions));
+            if (fd < 0) {
+                impl.last_error = "shm_open " + impl.config.name + ": " + std::strerror(errno);
+                return false;
+            }
+            ::fchmod(fd, static_cast<mode_t>(impl.config.permissions));     // umask 무시
+            if (::ftruncate(fd, static_cast<off_t>(total)) != 0) {
+                impl.last_error = std::string("ftruncate: ") + std::strerror(errno);
+                ::close(fd);
+                ::shm_unlink(impl.config.name.c_str());
+                return false;
+            }
+            void* memory = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (memory == MAP_FAILED) {
+                impl.last_error = std::string("mmap: ") + std::strerror(errno);
+                ::shm_unlink(impl.config.name.c_str());
+                return false;
+            }
+
+            // 새 세그먼트는 0으로 채워져 있어 슬롯 시퀀스와 리더 칸은 비어 있는 상태
+            impl.base = static_cast<uint8_t*>(memory);
+            impl.mapped_bytes = total;
+            impl.header = new (memory) SharedRingHeader();
+            SharedRingHeader& header = *impl.header;
+            header.version_major = kSharedRingVersionMajor;
+            header.version_minor = kSharedRingVersionMinor;
+            header.header_bytes = static_cast<uint32_t>(sizeof(SharedRingHeader));
+            header.names_offset = static_cast<uint32_t>(names_offset);
+            header.slots_offset = static_cast<uint32_t>(slots_offset);
+            header.slot_bytes = static_cast<uint32_t>(slot_bytes);
+            header.slot_count = impl.config.slot_count;
+            header.channel_count = static_cast<uint32_t>(channels);
+            header.writer_pid.store(static_cast<int32_t>(::getpid()), std::memory_order_relaxed);
+            header.magic.store(kSharedRingMagic, std::memory_order_release);
+            impl.last_error.clear();
+            return true;
+#endif
+        }
+
+        void SharedRingWriter::close() {
+            pImpl->close();
+        }
+
+        bool SharedRingWriter::isOpen() const {
+            return pImpl->header != nullptr;
+        }
+
+        void SharedRingWriter::setChannelNames(const Sensor::ChannelRegistry& registry) {
+            Impl& impl = *pImpl;
+            if (!impl.header) {
+                return;
+            }
+            SharedRingHeader& header = *impl.header;
+            const uint32_t generation = header.names_generation.load(std::memory_order_relaxed);
+            header.names_generation.store(generation + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t ch = 0; ch < header.channel_count; ++ch) {
+                copyName(nameAt(impl.base, header, ch),
+                         ch < registry.size() ? registry.getName(static_cast<Sensor::ChannelId>(ch)) : std::string());
+            }
+            header.names_generation.store(generation + 2, std::memory_order_release);
+        }
+
+        size_t SharedRingWriter::write(const Sensor::SensorBatch& batch) {
+            Impl& impl = *pImpl;
+            if (!impl.header || batch.empty()) {
+                return 0;
+            }
+            SharedRingHeader& header = *impl.header;
+            const size_t count = batch.size();
+            const size_t channels = std::min<size_t>(batch.channelCount(), header.channel_count);
+            const float nan = std::nanf("");
+            uint64_t sequence = header.write_sequence.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < count; ++i, ++sequence) {
+                SharedRingSlotHeader* slot = slotAt(impl.base, header, sequence);
+                // 쓰는 동안 시퀀스를 0으로 내려 리더가 덮어쓰기 중인 슬롯을 버리게 함
+                slot->sequence.store(0, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slot->timestamp_ns = batch.timestamps_ns[i];
+                slot->device_id = batch.device_id;
+                slot->quality = i < batch.quality.size() ? batch.quality[i] : 0;
+                float* values = slotValues(slot);
+                for (size_t ch = 0; ch < channels; ++ch) {
+                    values[ch] = batch.columns[ch][i];
+                }
+                std::fill(values + channels, values + header.channel_count, nan);
+                slot->sequence.store(sequence + 1, std::memory_order_release);
+            }
+            header.write_sequence.store(sequence, std::memory_order_release);
+            return count;
+        }
+
+        uint64_t SharedRingWriter::getWrittenCount() const {
+            return pImpl->header ? pImpl->header->write_sequence.load(std::memory_order_relaxed) : 0;
+        }
+
+        std::vector<SharedRingReaderInfo> SharedRingWriter::getReaders() const {
+            std::vector<SharedRingReaderInfo> readers;
+            const SharedRingHeader* header = pImpl->header;
+            if (!header) {
+                return readers;
+            }
+            const uint64_t written = header->write_sequence.load(std::memory_order_acquire);
+            for (const auto& entry : header->readers) {
+                const int32_t pid = entry.pid.load(std::memory_order_acquire);
+                if (pid == 0) {
+                    continue;
+                }
+                SharedRingReaderInfo info;
+                info.pid = pid;
+                info.name.assign(entry.name, strnlen(entry.name, kSharedRingNameBytes));
+                const uint64_t cursor = entry.cursor.load(std::memory_order_relaxed);
+                info.lag = written > cursor ? written - cursor : 0;
+                info.missed = entry.missed.load(std::memory_order_relaxed);
+                readers.push_back(std::move(info));
+            }
+            return readers;
+        }
+
+        const SharedRingConfig& SharedRingWriter::getConfig() const {
+            return pImpl->config;
+        }
+
+        std::string SharedRingWriter::getLastError() const {
+            return pImpl->last_error;
+        }
+
+        /// @brief SharedRingReader 구현 클래스 (Pimpl 패턴)
+        class SharedRingReader::Impl {
+        public:
+            std::string last_error;
+            uint8_t* base = nullptr;
+            size_t mapped_bytes = 0;
+            SharedRingHeader* header = nullptr;
+            SharedRingReaderEntry* entry = nullptr;
+            uint64_t next = 0;
+            uint64_t missed = 0;
+            std::vector<float> values;      // 슬롯 복사본 (시퀀스 확인 후 handler에 전달)
+
+            ~Impl() {
+                close();
+            }
+
+            void close() {
+#ifndef _WIN32
+                if (entry) {
+                    entry->pid.store(0, std::memory_order_release);
+                }
+                if (base) {
+                    ::munmap(base, mapped_bytes);
+                }
+#endif
+                base = nullptr;
+                header = nullptr;
+                entry = nullptr;
+                mapped_bytes = 0;
+            }
+
+            bool fail(const std::string& message) {
+                last_error = message;
+                close();
+                return false;
+            }
+        };
+
+        /// @brief SharedRingReader 메서드 구현
+        SharedRingReader::SharedRingReader() : pImpl(std::make_unique<Impl>()) {}
+        SharedRingReader::~SharedRingReader() = default;
+
+        bool SharedRingReader::open(const std::string& name, const std::string& reader_name) {
+            Impl& impl = *pImpl;
+            impl.close();
+#ifdef _WIN32
+            (void)name;
+            (void)reader_name;
+            impl.last_error = "shared memory export is only available on POSIX systems";
+            return false;
+#else
+            const int fd = ::shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0);
+            if (fd < 0) {
+                impl.last_error = "shm_open " + name + ": " + std::strerror(errno);
+                return false;
+            }
+            struct stat info {};
+            if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SharedRingHeader)) {
+                ::close(fd);
+                impl.last_error = name + " is not a sample ring";
+                return false;
+            }
+            const size_t size = static_cast<size_t>(info.st_size);
+            void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (memory == MAP_FAILED) {
+                impl.last_error = std::string("mmap: ") + std::strerror(errno);
+                return false;
+            }
+            impl.base = static_cast<uint8_t*>(memory);
+            impl.mapped_bytes = size;
+            impl.header = static_cast<SharedRingHeader*>(memory);
+            const SharedRingHeader& header = *impl.header;
+
+            if (header.magic.load(std::memory_order_acquire) != kSharedRingMagic) {
+                return impl.fail(name + " is not initialized");
+            }
+            if (header.version_major != kSharedRingVersionMajor) {
+                return impl.fail("unsupported ring version " + std::to_string(header.version_major) + "." +
+                                 std::to_string(header.version_minor));
+            }
+            const bool pow2 = header.slot_count >= 2 && (header.slot_count & (header.slot_count - 1)) == 0;
+            if (!pow2 || header.slot_bytes < sizeof(SharedRingSlotHeader) + header.channel_count * sizeof(float) ||
+                header.slots_offset + header.slot_count * header.slot_bytes > size) {
+                return impl.fail(name + " has an invalid layout");
+            }
+
+            const int32_t self = static_cast<int32_t>(::getpid());
+            for (auto& entry : impl.header->readers) {
+                int32_t pid = entry.pid.load(std::memory_order_acquire);
+                if (pid != 0 && processAlive(pid)) {
+                    continue;
+                }
+                if (entry.pid.compare_exchange_strong(pid, self, std::memory_order_acq_rel)) {
+                    copyName(entry.name, reader_name);
+                    entry.missed.store(0, std::memory_order_relaxed);
+                    impl.next = header.write_sequence.load(std::memory_order_acquire);
+                    entry.cursor.store(impl.next, std::memory_order_release);
+                    impl.entry = &entry;
+                    break;
+                }
+            }
+            if (!impl.entry) {
+                return impl.fail("no free reader slot (max " + std::to_string(kSharedRingMaxReaders) + ")");
+            }
+            impl.missed = 0;
+            impl.values.assign(header.channel_count, 0.0f);
+            impl.last_error.clear();
+            return true;
+#endif
+        }
+
+        void SharedRingReader::close() {
+            pImpl->close();
+        }
+
+        bool SharedRingReader::isOpen() const {
+            return pImpl->header != nullptr;
+        }
+
+        bool SharedRingReader::isWriterAlive() const {
+#ifdef _WIN32
+            return false;
+#else
+            return pImpl->header && processAlive(pImpl->header->writer_pid.load(std::memory_order_acquire));
+#endif
+        }
+
+        size_t SharedRingReader::poll(const std::function<void(const SharedSample&)>& handler, size_t max_samples) {
+            Impl& impl = *pImpl;
+            if (!impl.header) {
+                return 0;
+            }
+            const SharedRingHeader& header = *impl.header;
+            const size_t channels = header.channel_count;
+            SharedSample sample;
+            sample.values = impl.values.data();
+            sample.channel_count = channels;
+            size_t processed = 0;
+            while (processed < max_samples) {
+                SharedRingSlotHeader* slot = slotAt(impl.base, header, impl.next);
+                const uint64_t published = slot->sequence.load(std::memory_order_acquire);
+                if (published == impl.next + 1) {
+                    sample.sequence = impl.next;
+                    sample.timestamp_ns = slot->timestamp_ns;
+                    sample.device_id = slot->device_id;
+                    sample.quality = slot->quality;
+                    std::memcpy(impl.values.data(), slotValues(slot), channels * sizeof(float));
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot->sequence.load(std::memory_order_relaxed) == published) {
+                        handler(sample);
+                        ++impl.next;
+                        ++processed;
+                        if ((processed & (kCursorPublishInterval - 1)) == 0) {
+                            impl.entry->cursor.store(impl.next, std::memory_order_release);
+                        }
+                        continue;
+                    }
+                } else if (header.write_sequence.load(std::memory_order_acquire) <= impl.next + header.slot_count) {
+                    break;      // 아직 안 쓰였거나 지금 이 시퀀스를 쓰는 중
+                }
+                // 한 바퀴 뒤처짐: 남아 있는 구간의 앞쪽 1/4을 건너뛰어 다시 덮이기 전에 따라잡을 여유를 둠
+                const uint64_t written = header.write_sequence.load(std::memory_order_acquire);
+                const uint64_t oldest = written > header.slot_count ? written - header.slot_count : 0;
+                const uint64_t resume = std::max(std::min(oldest + header.slot_count / 4, written), impl.next + 1);
+                impl.missed += resume - impl.next;
+                impl.next = resume;
+                impl.entry->missed.store(impl.missed, std::memory_order_relaxed);
+            }
+            impl.entry->cursor.store(impl.next, std::memory_order_release);
+            return processed;
+        }
+
+        uint64_t SharedRingReader::getLag() const {
+            if (!pImpl->header) {
+                return 0;
+            }
+            const uint64_t written = pImpl->header->write_sequence.load(std::memory_order_acquire);
+            return written > pImpl->next ? written - pImpl->next : 0;
+        }
+
+        uint64_t SharedRingReader::getMissedCount() const {
+            return pImpl->missed;
+        }
+
+        size_t SharedRingReader::getChannelCount() const {
+            return pImpl->header ? pImpl->header->channel_count : 0;
+        }
+
+        std::string SharedRingReader::getChannelName(size_t channel) const {
+            Impl& impl = *pImpl;
+            if (!impl.header || channel >= impl.header->channel_count) {
+                return std::string();
+            }
+            const SharedRingHeader& header = *impl.header;
+            char name[kSharedRingNameBytes];
+            while (true) {
+                const uint32_t generation = header.names_generation.load(std::memory_order_acquire);
+                if (generation & 1) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::memcpy(name, nameAt(impl.base, header, channel), sizeof(name));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header.names_generation.load(std::memory_order_relaxed) == generation) {
+                    break;
+                }
+            }
+            return std::string(name, strnlen(name, sizeof(name)));
+        }
+
+        std::string SharedRingReader::getLastError() const {
+            return pImpl->last_error;
+        }
+
+    } // namespace Ipc
+} // namespace DachshundEngine
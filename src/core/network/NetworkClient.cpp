@@ -284,11 +284,11 @@ namespace DachshundEngine {
         /// @brief JSON 유틸리티 함수 구현
         namespace JsonUtil {
             
-            std::string sensorDataToJson(const Sensor::SensorData& data) {
+            std::string sensorDataToJson(const Sensor::SensorData& data, uint64_t timestamp_ms) {
                 std::ostringstream oss;
                 oss << "{"
                     << "\"type\":\"sensor_data\","
-                    << "\"timestamp\":" << 0 << ","
+                    << "\"timestamp\":" << timestamp_ms << ","
                     << "\"data\":{"
                     << "\"temperature\":" << data.temperature << ","
                     << "\"humidity\":" << data.humidity << ","
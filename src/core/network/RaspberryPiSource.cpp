@@ -0,0 +1,101 @@
+#include "core/network/RaspberryPiSource.h"
+#include <atomic>
+#include <cstring>
+
+namespace DachshundEngine {
+    namespace Network {
+
+        /// @brief RaspberryPiSource 구현 클래스 (Pimpl 패턴)
+        class RaspberryPiSource::Impl {
+        public:
+            NetworkClient client;
+            std::string ip_address = "127.0.0.1";
+            int port = 8080;
+            std::atomic<bool> connected{false};     // UI 스레드에서 잠금 없이 읽음
+            std::function<void(ConnectionState)> onConnectionStateChanged;
+
+            // read() 동안만 설정되는 출력 대상 (수신 콜백이 여기에 샘플을 추가)
+            Sensor::SensorBatch* target = nullptr;
+            Time::Timestamp target_time = 0;
+            size_t received = 0;
+        };
+
+        /// @brief RaspberryPiSource 메서드 구현
+        RaspberryPiSource::RaspberryPiSource() : pImpl(std::make_unique<Impl>()) {
+            Impl* impl = pImpl.get();
+            impl->client.setOnSensorDataReceived([impl](const Sensor::SensorData& data) {
+                if (impl->target) {
+                    impl->target->append(data, impl->target_time);
+                    impl->received++;
+                }
+            });
+            impl->client.setOnConnectionStateChanged([impl](ConnectionState state) {
+                impl->connected = (state == ConnectionState::CONNECTED);
+                if (impl->onConnectionStateChanged) {
+                    impl->onConnectionStateChanged(state);
+                }
+            });
+        }
+        RaspberryPiSource::~RaspberryPiSource() = default;
+
+        const char* RaspberryPiSource::getType() const {
+            return "raspberry_pi";
+        }
+
+        bool RaspberryPiSource::start() {
+            pImpl->connected = pImpl->client.connect(pImpl->ip_address, pImpl->port);
+            return pImpl->connected;
+        }
+
+        void RaspberryPiSource::stop() {
+            pImpl->client.disconnect();
+            pImpl->connected = false;
+        }
+
+        bool RaspberryPiSource::isRunning() const {
+            return pImpl->connected;
+        }
+
+        size_t RaspberryPiSource::read(Sensor::SensorBatch& out, Time::Timestamp now) {
+            if (!pImpl->connected) {
+                return 0;
+            }
+            out.device_id = device_id;
+            pImpl->target = &out;
+            pImpl->target_time = now;
+            pImpl->received = 0;
+            pImpl->client.processIncomingMessages();
+            pImpl->target = nullptr;
+            return pImpl->received;
+        }
+
+        bool RaspberryPiSource::handleCommand(const char* command, float value) {
+            if (std::strcmp(command, "set_sampling_rate") == 0) {
+                return pImpl->client.setSamplingRate(static_cast<int>(value));
+            }
+            if (std::strcmp(command, "request_sensor_data") == 0) {
+                return pImpl->client.requestSensorData();
+            }
+            return false;
+        }
+
+        std::string RaspberryPiSource::getStatus() const {
+            return (pImpl->connected ? "connected to " : "disconnected from ") + pImpl->ip_address + ":" +
+                   std::to_string(pImpl->port);
+        }
+
+        void RaspberryPiSource::setAddress(const std::string& ip_address, int port) {
+            pImpl->ip_address = ip_address;
+            pImpl->port = port;
+        }
+
+        void RaspberryPiSource::setOnConnectionStateChanged(std::function<void(ConnectionState)> callback) {
+            pImpl->onConnectionStateChanged = std::move(callback);
+        }
+
+        NetworkClient& RaspberryPiSource::getClient() {
+            return pImpl->client;
+        }
+
+    } // namespace Network
+} // namespace DachshundEngine
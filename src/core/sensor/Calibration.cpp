@@ -0,0 +1,168 @@
+#include "core/sensor/Calibration.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            uint64_t entryKey(uint32_t device_id, ChannelId channel) {
+                return (static_cast<uint64_t>(device_id) << 16) | channel;
+            }
+
+            /// @brief values[i] = values[i] * gain + offset (자동 벡터화되는 형태)
+            void applyLinear(float* values, size_t n, float gain, float offset) {
+                for (size_t i = 0; i < n; ++i) {
+                    values[i] = values[i] * gain + offset;
+                }
+            }
+
+            /// @brief 균등 간격 LUT 선형 보간 (분기 없이 위치를 고정, NaN은 그대로 통과)
+            void applyLut(float* values, size_t n, const ChannelCalibration& cal) {
+                const float* lut = cal.lut.data();
+                const size_t last_segment = cal.lut.size() - 2;
+                const float last = static_cast<float>(cal.lut.size() - 1);
+                const float scale = last / (cal.lut_max - cal.lut_min);
+                const float origin = cal.lut_min;
+                for (size_t i = 0; i < n; ++i) {
+                    const float x = values[i];
+                    // fmax/fmin은 NaN을 0으로 만들어 인덱스를 안전하게 유지
+                    const float position = std::fmin(std::fmax((x - origin) * scale, 0.0f), last);
+                    const size_t index = std::min(static_cast<size_t>(position), last_segment);
+                    const float frac = position - static_cast<float>(index);
+                    const float y = lut[index] + (lut[index + 1] - lut[index]) * frac;
+                    values[i] = std::isnan(x) ? x : y;
+                }
+            }
+
+            std::string trim(const std::string& s) {
+                size_t begin = s.find_first_not_of(" \t\r");
+                size_t end = s.find_last_not_of(" \t\r");
+                return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+            }
+
+            bool parseFloat(const std::string& s, float& out) {
+                char* end = nullptr;
+                out = std::strtof(s.c_str(), &end);
+                return !s.empty() && end == s.c_str() + s.size();
+            }
+        }
+
+        /// @brief CalibrationTable 메서드 구현
+        void CalibrationTable::set(uint32_t device_id, ChannelId channel, const ChannelCalibration& calibration) {
+            entries[entryKey(device_id, channel)] = calibration;
+        }
+
+        bool CalibrationTable::remove(uint32_t device_id, ChannelId channel) {
+            return entries.erase(entryKey(device_id, channel)) > 0;
+        }
+
+        void CalibrationTable::clear() {
+            entries.clear();
+        }
+
+        const ChannelCalibration* CalibrationTable::find(uint32_t device_id, ChannelId channel) const {
+            auto it = entries.find(entryKey(device_id, channel));
+            if (it == entries.end() && device_id != kAllDevices) {
+                it = entries.find(entryKey(kAllDevices, channel));
+            }
+            return it != entries.end() ? &it->second : nullptr;
+        }
+
+        void CalibrationTable::forEach(const std::function<void(uint32_t, ChannelId, const ChannelCalibration&)>& fn) const {
+            for (const auto& entry : entries) {
+                fn(static_cast<uint32_t>(entry.first >> 16), static_cast<ChannelId>(entry.first & 0xFFFF), entry.second);
+            }
+        }
+
+        void CalibrationTable::apply(SensorBatch& batch) const {
+            if (entries.empty() || batch.empty()) {
+                return;
+            }
+            for (size_t ch = 0; ch < batch.channelCount(); ++ch) {
+                const ChannelCalibration* cal = find(batch.device_id, static_cast<ChannelId>(ch));
+                if (!cal) {
+                    continue;
+                }
+                std::vector<float>& column = batch.columns[ch];
+                if (cal->gain != 1.0f || cal->offset != 0.0f) {
+                    applyLinear(column.data(), column.size(), cal->gain, cal->offset);
+                }
+                if (cal->hasLut()) {
+                    applyLut(column.data(), column.size(), *cal);
+                }
+            }
+        }
+
+        bool loadCalibrationCsv(const std::string& path, const ChannelRegistry& registry,
+                                CalibrationTable& out, std::string& error) {
+            std::ifstream file(path);
+            if (!file) {
+                error = "cannot open " + path;
+                return false;
+            }
+            CalibrationTable table;
+            std::string line;
+            size_t line_number = 0;
+            while (std::getline(file, line)) {
+                line_number++;
+                line = trim(line);
+                if (line.empty() || line[0] == '#') {
+                    continue;
+                }
+                std::vector<std::string> fields;
+                size_t begin = 0;
+                while (true) {
+                    size_t comma = line.find(',', begin);
+                    fields.push_back(trim(line.substr(begin, comma == std::string::npos ? std::string::npos : comma - begin)));
+                    if (comma == std::string::npos) {
+                        break;
+                    }
+                    begin = comma + 1;
+                }
+
+                const std::string where = path + ":" + std::to_string(line_number) + ": ";
+                if (fields.size() < 4 || (fields.size() > 4 && fields.size() < 8)) {
+                    error = where + "expected device,channel,gain,offset[,lut_min,lut_max,y0,y1,...]";
+                    return false;
+                }
+                uint32_t device_id = CalibrationTable::kAllDevices;
+                if (fields[0] != "*") {
+                    char* end = nullptr;
+                    unsigned long value = std::strtoul(fields[0].c_str(), &end, 10);
+                    if (fields[0].empty() || end != fields[0].c_str() + fields[0].size() || value >= CalibrationTable::kAllDevices) {
+                        error = where + "bad device '" + fields[0] + "'";
+                        return false;
+                    }
+                    device_id = static_cast<uint32_t>(value);
+                }
+                ChannelId channel;
+                if (!registry.find(fields[1], channel)) {
+                    error = where + "unknown channel '" + fields[1] + "'";
+                    return false;
+                }
+
+                ChannelCalibration cal;
+                bool ok = parseFloat(fields[2], cal.gain) && parseFloat(fields[3], cal.offset);
+                if (ok && fields.size() > 4) {
+                    ok = parseFloat(fields[4], cal.lut_min) && parseFloat(fields[5], cal.lut_max) && cal.lut_max > cal.lut_min;
+                    cal.lut.resize(fields.size() - 6);
+                    for (size_t i = 0; ok && i < cal.lut.size(); ++i) {
+                        ok = parseFloat(fields[6 + i], cal.lut[i]);
+                    }
+                }
+                if (!ok) {
+                    error = where + "bad number";
+                    return false;
+                }
+                table.set(device_id, channel, cal);
+            }
+            out = std::move(table);
+            error.clear();
+            return true;
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,537 @@
+#include "core/sensor/DerivedChannels.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            enum class OpCode : uint8_t {
+                LOAD_CHANNEL,
+                LOAD_CONST,
+                ADD, SUB, MUL, DIV, POW, MIN, MAX, DEWPOINT,   // 이항
+                NEG, ABS, SQRT, EXP, LOG                       // 단항
+            };
+
+            struct Instruction {
+                OpCode op;
+                ChannelId channel = 0;
+                float constant = 0.0f;
+            };
+
+            struct Program {
+                std::vector<Instruction> code;
+                size_t max_depth = 0;
+            };
+
+            bool isBinary(OpCode op) {
+                return op >= OpCode::ADD && op <= OpCode::DEWPOINT;
+            }
+
+            bool isUnary(OpCode op) {
+                return op >= OpCode::NEG;
+            }
+
+            /// @brief Magnus 식 이슬점 (°C, %RH)
+            inline float dewPoint(float t, float rh) {
+                constexpr float b = 17.62f;
+                constexpr float c = 243.12f;
+                float gamma = std::log(rh / 100.0f) + b * t / (c + t);
+                return c * gamma / (b - gamma);
+            }
+
+            float applyBinary(OpCode op, float a, float b) {
+                switch (op) {
+                case OpCode::ADD:      return a + b;
+                case OpCode::SUB:      return a - b;
+                case OpCode::MUL:      return a * b;
+                case OpCode::DIV:      return a / b;
+                case OpCode::POW:      return std::pow(a, b);
+                case OpCode::MIN:      return std::fmin(a, b);
+                case OpCode::MAX:      return std::fmax(a, b);
+                case OpCode::DEWPOINT: return dewPoint(a, b);
+                default:               return 0.0f;
+                }
+            }
+
+            float applyUnary(OpCode op, float a) {
+                switch (op) {
+                case OpCode::NEG:  return -a;
+                case OpCode::ABS:  return std::fabs(a);
+                case OpCode::SQRT: return std::sqrt(a);
+                case OpCode::EXP:  return std::exp(a);
+                case OpCode::LOG:  return std::log(a);
+                default:           return 0.0f;
+                }
+            }
+
+            /// @brief 재귀 하강 파서: 식을 후위 바이트코드로 바로 내보낸다
+            /// @details expr := term (('+'|'-') term)*
+            ///          term := unary (('*'|'/') unary)*
+            ///          unary := '-' unary | power
+            ///          power := primary ('^' unary)?
+            ///          primary := number | name | name '(' args ')' | '(' expr ')'
+            class Parser {
+            public:
+                using Resolver = bool (*)(const void* ctx, const std::string& name, ChannelId& out);
+
+                Parser(const std::string& text, Resolver resolver, const void* ctx)
+                    : text(text), resolver(resolver), ctx(ctx) {}
+
+                bool parse(Program& out, std::string& error) {
+                    bool ok = parseExpr();
+                    skipSpace();
+                    if (ok && pos != text.size()) {
+                        fail("unexpected '" + std::string(1, text[pos]) + "'");
+                        ok = false;
+                    }
+                    if (ok && program.code.empty()) {
+                        fail("empty expression");
+                        ok = false;
+                    }
+                    if (!ok) {
+                        error = message;
+                        return false;
+                    }
+                    out = std::move(program);
+                    return true;
+                }
+
+            private:
+                const std::string& text;
+                Resolver resolver;
+                const void* ctx;
+                size_t pos = 0;
+                size_t depth = 0;
+                Program program;
+                std::string message;
+
+                bool fail(const std::string& what) {
+                    if (message.empty()) {
+                        message = what + " at position " + std::to_string(pos);
+                    }
+                    return false;
+                }
+
+                void skipSpace() {
+                    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+                        ++pos;
+                    }
+                }
+
+                bool accept(char c) {
+                    skipSpace();
+                    if (pos < text.size() && text[pos] == c) {
+                        ++pos;
+                        return true;
+                    }
+                    return false;
+                }
+
+                /// @brief 명령어 추가 (상수끼리의 연산은 컴파일 시점에 접음)
+                void emit(const Instruction& inst) {
+                    auto& code = program.code;
+                    size_t n = code.size();
+                    if (isBinary(inst.op) && n >= 2 &&
+                        code[n - 1].op == OpCode::LOAD_CONST && code[n - 2].op == OpCode::LOAD_CONST) {
+                        code[n - 2].constant = applyBinary(inst.op, code[n - 2].constant, code[n - 1].constant);
+                        code.pop_back();
+                        --depth;
+                        return;
+                    }
+                    if (isUnary(inst.op) && n >= 1 && code[n - 1].op == OpCode::LOAD_CONST) {
+                        code[n - 1].constant = applyUnary(inst.op, code[n - 1].constant);
+                        return;
+                    }
+
+                    code.push_back(inst);
+                    if (inst.op == OpCode::LOAD_CHANNEL || inst.op == OpCode::LOAD_CONST) {
+                        program.max_depth = std::max(program.max_depth, ++depth);
+                    } else if (isBinary(inst.op)) {
+                        --depth;
+                    }
+                }
+
+                bool parseExpr() {
+                    if (!parseTerm()) return false;
+                    while (true) {
+                        if (accept('+')) {
+                            if (!parseTerm()) return false;
+                            emit({OpCode::ADD});
+                        } else if (accept('-')) {
+                            if (!parseTerm()) return false;
+                            emit({OpCode::SUB});
+                        } else {
+                            return true;
+                        }
+                    }
+                }
+
+                bool parseTerm() {
+                    if (!parseUnary()) return false;
+                    while (true) {
+                        if (accept('*')) {
+                            if (!parseUnary()) return false;
+                            emit({OpCode::MUL});
+                        } else if (accept('/')) {
+                            if (!parseUnary()) return false;
+                            emit({OpCode::DIV});
+                        } else {
+                            return true;
+                        }
+                    }
+                }
+
+                bool parseUnary() {
+                    if (accept('-')) {
+                        if (!parseUnary()) return false;
+                        emit({OpCode::NEG});
+                        return true;
+                    }
+                    if (accept('+')) {
+                        return parseUnary();
+                    }
+                    return parsePower();
+                }
+
+                bool parsePower() {
+                    if (!parsePrimary()) return false;
+                    if (accept('^')) {
+                        if (!parseUnary()) return false;
+                        emit({OpCode::POW});
+                    }
+                    return true;
+                }
+
+                bool parsePrimary() {
+                    skipSpace();
+                    if (pos >= text.size()) {
+                        return fail("unexpected end of expression");
+                    }
+
+                    if (accept('(')) {
+                        if (!parseExpr()) return false;
+                        return accept(')') ? true : fail("expected ')'");
+                    }
+
+                    char c = text[pos];
+                    if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+                        const char* begin = text.c_str() + pos;
+                        char* end = nullptr;
+                        float value = std::strtof(begin, &end);
+                        if (end == begin) {
+                            return fail("invalid number");
+                        }
+                        pos += static_cast<size_t>(end - begin);
+                        emit({OpCode::LOAD_CONST, 0, value});
+                        return true;
+                    }
+
+                    if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+                        size_t start = pos;
+                        while (pos < text.size() &&
+                               (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '_')) {
+                            ++pos;
+                        }
+                        std::string name = text.substr(start, pos - start);
+                        if (accept('(')) {
+                            return parseCall(name);
+                        }
+                        ChannelId channel;
+                        if (!resolver(ctx, name, channel)) {
+                            pos = start;
+                            return fail("unknown channel '" + name + "'");
+                        }
+                        emit({OpCode::LOAD_CHANNEL, channel, 0.0f});
+                        return true;
+                    }
+
+                    return fail("unexpected '" + std::string(1, c) + "'");
+                }
+
+                bool parseCall(const std::string& name) {
+                    struct Function { const char* name; OpCode op; int arity; };
+                    static const Function functions[] = {
+                        {"min", OpCode::MIN, 2}, {"max", OpCode::MAX, 2}, {"pow", OpCode::POW, 2},
+                        {"dewpoint", OpCode::DEWPOINT, 2}, {"abs", OpCode::ABS, 1},
+                        {"sqrt", OpCode::SQRT, 1}, {"exp", OpCode::EXP, 1}, {"log", OpCode::LOG, 1},
+                    };
+                    const Function* fn = nullptr;
+                    for (const auto& f : functions) {
+                        if (name == f.name) {
+                            fn = &f;
+                        }
+                    }
+                    if (!fn) {
+                        return fail("unknown function '" + name + "'");
+                    }
+
+                    int args = 0;
+                    if (!accept(')')) {
+                        do {
+                            if (!parseExpr()) return false;
+                            ++args;
+                        } while (accept(','));
+                        if (!accept(')')) {
+                            return fail("expected ')'");
+                        }
+                    }
+                    if (args != fn->arity) {
+                        return fail(name + "() takes " + std::to_string(fn->arity) + " argument(s)");
+                    }
+                    emit({fn->op});
+                    return true;
+                }
+            };
+
+            /// @brief 평가 스택 항목 (채널 열 포인터 또는 스칼라)
+            struct StackEntry {
+                const float* data = nullptr;
+                float scalar = 0.0f;
+                bool is_scalar = false;
+            };
+
+            template <typename F>
+            void applyColumns(StackEntry& a, const StackEntry& b, float* out, size_t n, F f) {
+                if (a.is_scalar && b.is_scalar) {
+                    a.scalar = f(a.scalar, b.scalar);
+                    return;
+                }
+                if (a.is_scalar) {
+                    const float s = a.scalar;
+                    const float* y = b.data;
+                    for (size_t j = 0; j < n; ++j) out[j] = f(s, y[j]);
+                } else if (b.is_scalar) {
+                    const float* x = a.data;
+                    const float s = b.scalar;
+                    for (size_t j = 0; j < n; ++j) out[j] = f(x[j], s);
+                } else {
+                    const float* x = a.data;
+                    const float* y = b.data;
+                    for (size_t j = 0; j < n; ++j) out[j] = f(x[j], y[j]);
+                }
+                a = StackEntry{out, 0.0f, false};
+            }
+
+            template <typename F>
+            void applyColumn(StackEntry& a, float* out, size_t n, F f) {
+                if (a.is_scalar) {
+                    a.scalar = f(a.scalar);
+                    return;
+                }
+                const float* x = a.data;
+                for (size_t j = 0; j < n; ++j) out[j] = f(x[j]);
+                a = StackEntry{out, 0.0f, false};
+            }
+        }
+
+        /// @brief DerivedChannelSet 구현 클래스 (Pimpl 패턴)
+        class DerivedChannelSet::Impl {
+        public:
+            struct Definition {
+                std::string name;
+                std::string expression;
+                ChannelId channel = 0;
+                Program program;
+            };
+
+            ChannelRegistry& registry;
+            std::vector<Definition> definitions;
+            std::vector<std::vector<float>> registers;   // 스택 깊이별 작업 버퍼
+            std::vector<StackEntry> stack;
+            std::string last_error;
+
+            // 식 컴파일 중 참조 가능 여부 판단용
+            size_t compiling_index = 0;
+
+            explicit Impl(ChannelRegistry& reg) : registry(reg) {}
+
+            static bool resolve(const void* ctx, const std::string& name, ChannelId& out) {
+                const Impl* self = static_cast<const Impl*>(ctx);
+                if (!self->registry.find(name, out)) {
+                    return false;
+                }
+                // 자기 자신이나 뒤에 정의된 파생 채널은 아직 계산되지 않았으므로 참조 불가
+                for (size_t i = self->compiling_index; i < self->definitions.size(); ++i) {
+                    if (self->definitions[i].channel == out) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            void run(const Program& program, SensorBatch& batch, ChannelId target) {
+                const size_t n = batch.size();
+                if (registers.size() < program.max_depth) {
+                    registers.resize(program.max_depth);
+                }
+                stack.clear();
+
+                for (const auto& inst : program.code) {
+                    switch (inst.op) {
+                    case OpCode::LOAD_CHANNEL:
+                        stack.push_back(StackEntry{batch.columns[inst.channel].data(), 0.0f, false});
+                        continue;
+                    case OpCode::LOAD_CONST:
+                        stack.push_back(StackEntry{nullptr, inst.constant, true});
+                        continue;
+                    default:
+                        break;
+                    }
+
+                    size_t top = stack.size() - 1;
+                    if (isBinary(inst.op)) {
+                        auto& out_reg = registers[top - 1];
+                        if (out_reg.size() < n) out_reg.resize(n);
+                        StackEntry& a = stack[top - 1];
+                        const StackEntry& b = stack[top];
+                        float* out = out_reg.data();
+                        switch (inst.op) {
+                        case OpCode::ADD: applyColumns(a, b, out, n, [](float x, float y) { return x + y; }); break;
+                        case OpCode::SUB: applyColumns(a, b, out, n, [](float x, float y) { return x - y; }); break;
+                        case OpCode::MUL: applyColumns(a, b, out, n, [](float x, float y) { return x * y; }); break;
+                        case OpCode::DIV: applyColumns(a, b, out, n, [](float x, float y) { return x / y; }); break;
+                        case OpCode::MIN: applyColumns(a, b, out, n, [](float x, float y) { return x < y ? x : y; }); break;
+                        case OpCode::MAX: applyColumns(a, b, out, n, [](float x, float y) { return x > y ? x : y; }); break;
+                        case OpCode::POW: applyColumns(a, b, out, n, [](float x, float y) { return std::pow(x, y); }); break;
+                        case OpCode::DEWPOINT: applyColumns(a, b, out, n, dewPoint); break;
+                        default: break;
+                        }
+                        stack.pop_back();
+                    } else {
+                        auto& out_reg = registers[top];
+                        if (out_reg.size() < n) out_reg.resize(n);
+                        StackEntry& a = stack[top];
+                        float* out = out_reg.data();
+                        switch (inst.op) {
+                        case OpCode::NEG:  applyColumn(a, out, n, [](float x) { return -x; }); break;
+                        case OpCode::ABS:  applyColumn(a, out, n, [](float x) { return std::fabs(x); }); break;
+                        case OpCode::SQRT: applyColumn(a, out, n, [](float x) { return std::sqrt(x); }); break;
+                        case OpCode::EXP:  applyColumn(a, out, n, [](float x) { return std::exp(x); }); break;
+                        case OpCode::LOG:  applyColumn(a, out, n, [](float x) { return std::log(x); }); break;
+                        default: break;
+                        }
+                    }
+                }
+
+                auto& dst = batch.columns[target];
+                const StackEntry& result = stack.back();
+                if (result.is_scalar) {
+                    std::fill(dst.begin(), dst.end(), result.scalar);
+                } else {
+                    std::copy(result.data, result.data + n, dst.begin());
+                }
+            }
+        };
+
+        /// @brief DerivedChannelSet 메서드 구현
+        DerivedChannelSet::DerivedChannelSet(ChannelRegistry& registry) : pImpl(std::make_unique<Impl>(registry)) {}
+        DerivedChannelSet::~DerivedChannelSet() = default;
+        DerivedChannelSet::DerivedChannelSet(DerivedChannelSet&&) noexcept = default;
+        DerivedChannelSet& DerivedChannelSet::operator=(DerivedChannelSet&&) noexcept = default;
+
+        bool DerivedChannelSet::define(const std::string& name, const std::string& expression, ChannelId& out_channel) {
+            ChannelId existing;
+            if (pImpl->registry.find(name, existing) && existing < kSensorChannelCount) {
+                pImpl->last_error = "cannot redefine base channel '" + name + "'";
+                return false;
+            }
+            if (name.empty()) {
+                pImpl->last_error = "channel name is empty";
+                return false;
+            }
+            const bool known = pImpl->registry.find(name, existing);
+            if (known && pImpl->registry.getOwner(existing) == ChannelOwner::FILTER) {
+                pImpl->last_error = "'" + name + "' is already a " + channelOwnerName(ChannelOwner::FILTER);
+                return false;
+            }
+            if (!known && pImpl->registry.isFull()) {
+                pImpl->last_error = "channel limit reached (" + std::to_string(kMaxExtendedChannels) + " extended channels)";
+                return false;
+            }
+
+            size_t index = pImpl->definitions.size();
+            for (size_t i = 0; i < pImpl->definitions.size(); ++i) {
+                if (pImpl->definitions[i].name == name) {
+                    index = i;
+                }
+            }
+
+            Program program;
+            std::string error;
+            pImpl->compiling_index = index;
+            Parser parser(expression, &Impl::resolve, pImpl.get());
+            if (!parser.parse(program, error)) {
+                pImpl->last_error = error;
+                return false;
+            }
+
+            Impl::Definition def{name, expression, pImpl->registry.registerChannel(name), std::move(program)};
+            if (index == pImpl->definitions.size()) {
+                pImpl->definitions.push_back(std::move(def));
+            } else {
+                pImpl->definitions[index] = std::move(def);
+            }
+            out_channel = pImpl->definitions[index].channel;
+            pImpl->registry.setOwner(out_channel, ChannelOwner::DERIVED);
+            pImpl->last_error.clear();
+            return true;
+        }
+
+        bool DerivedChannelSet::remove(const std::string& name) {
+            auto& defs = pImpl->definitions;
+            for (size_t i = 0; i < defs.size(); ++i) {
+                if (defs[i].name != name) {
+                    continue;
+                }
+                // 이 채널을 참조하는 뒤쪽 정의가 있으면 제거할 수 없음
+                for (size_t j = i + 1; j < defs.size(); ++j) {
+                    for (const auto& inst : defs[j].program.code) {
+                        if (inst.op == OpCode::LOAD_CHANNEL && inst.channel == defs[i].channel) {
+                            pImpl->last_error = "'" + defs[j].name + "' depends on '" + name + "'";
+                            return false;
+                        }
+                    }
+                }
+                pImpl->registry.setOwner(defs[i].channel, ChannelOwner::NONE);
+                defs.erase(defs.begin() + static_cast<std::ptrdiff_t>(i));
+                return true;
+            }
+            return false;
+        }
+
+        size_t DerivedChannelSet::size() const {
+            return pImpl->definitions.size();
+        }
+
+        const std::string& DerivedChannelSet::getName(size_t index) const {
+            return pImpl->definitions[index].name;
+        }
+
+        const std::string& DerivedChannelSet::getExpression(size_t index) const {
+            return pImpl->definitions[index].expression;
+        }
+
+        ChannelId DerivedChannelSet::getChannel(size_t index) const {
+            return pImpl->definitions[index].channel;
+        }
+
+        void DerivedChannelSet::evaluate(SensorBatch& batch) {
+            if (pImpl->definitions.empty() || batch.empty()) {
+                return;
+            }
+            batch.ensureChannels(pImpl->registry.size());
+            for (const auto& def : pImpl->definitions) {
+                pImpl->run(def.program, batch, def.channel);
+            }
+        }
+
+        std::string DerivedChannelSet::getLastError() const {
+            return pImpl->last_error;
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,349 @@
+#include "core/sensor/FilterBank.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            constexpr double kPi = 3.14159265358979323846;
+
+            /// @brief 저역 통과 필터 축 한 스텝 (NaN 입력 자리는 상태와 출력을 유지)
+            /// @details 배열이 서로 겹치지 않는다고 알려 런타임 별칭 검사 없이 벡터화되게 한다.
+            ///          상태 유지에 선택문을 쓰면 GCC가 같은 값 다시 쓰기를 지워 조건부 저장이 되므로 0/1 가중치로 섞는다
+            ///          (x = 0이면 y, n1, n2가 유한해 0 * 값 = 0이므로 섞은 결과는 정확히 한쪽 값).
+            void biquadStep(size_t count, const float* __restrict in,
+                            const float* __restrict b0, const float* __restrict b1, const float* __restrict b2,
+                            const float* __restrict a1, const float* __restrict a2,
+                            float* __restrict z1, float* __restrict z2, float* __restrict last, float* __restrict out) {
+                for (size_t f = 0; f < count; ++f) {
+                    const float raw = in[f];
+                    const float keep = std::isnan(raw) ? 1.0f : 0.0f;
+                    const float take = 1.0f - keep;
+                    const float x = std::isnan(raw) ? 0.0f : raw;
+                    const float prev1 = z1[f];
+                    const float prev2 = z2[f];
+                    const float y = b0[f] * x + prev1;
+                    const float n1 = b1[f] * x - a1[f] * y + prev2;
+                    const float n2 = b2[f] * x - a2[f] * y;
+                    const float next = take * y + keep * last[f];
+                    z1[f] = take * n1 + keep * prev1;
+                    z2[f] = take * n2 + keep * prev2;
+                    last[f] = next;
+                    out[f] = next;
+                }
+            }
+        }
+
+        const char* filterTypeName(FilterType type) {
+            switch (type) {
+            case FilterType::EMA:     return "ema";
+            case FilterType::LOWPASS: return "lowpass";
+            case FilterType::MEDIAN:  return "median";
+            default:                  return "filter";
+            }
+        }
+
+        /// @brief FilterBank 구현 클래스 (Pimpl 패턴)
+        class FilterBank::Impl {
+        public:
+            struct Definition {
+                FilterSpec spec;
+                ChannelId channel;
+            };
+
+            /// @brief 같은 종류 필터의 입출력 채널과 계수 (필터 축 SoA)
+            struct Group {
+                std::vector<ChannelId> source;
+                std::vector<ChannelId> target;
+                std::vector<float> alpha;                      // EMA
+                std::vector<float> b0, b1, b2, a1, a2;         // LOWPASS
+                std::vector<size_t> window;                    // MEDIAN
+
+                size_t size() const { return source.size(); }
+            };
+
+            /// @brief 디바이스 하나의 필터 상태 (그룹 순서와 같은 인덱스)
+            struct DeviceState {
+                std::vector<float> ema_y;
+                std::vector<float> z1, z2, lowpass_y;         // z1이 NaN이면 아직 첫 유효 샘플을 받지 않은 필터
+                size_t lowpass_unseeded = 0;
+                std::vector<float> median_ring;                // [filter][kMaxMedianWindow]
+                std::vector<size_t> median_count, median_pos;
+            };
+
+            ChannelRegistry& registry;
+            std::vector<Definition> filters;
+            Group ema, lowpass, median;
+            std::unordered_map<uint32_t, DeviceState> devices;
+            std::vector<float> xs, ys, window_values;
+            std::string last_error;
+
+            explicit Impl(ChannelRegistry& reg) : registry(reg) {}
+
+            void rebuild() {
+                ema = Group();
+                lowpass = Group();
+                median = Group();
+                for (const auto& def : filters) {
+                    const FilterSpec& spec = def.spec;
+                    Group& group = spec.type == FilterType::EMA ? ema
+                                 : spec.type == FilterType::LOWPASS ? lowpass : median;
+                    group.source.push_back(spec.source);
+                    group.target.push_back(def.channel);
+                    if (spec.type == FilterType::EMA) {
+                        group.alpha.push_back(spec.alpha);
+                    } else if (spec.type == FilterType::LOWPASS) {
+                        // RBJ 저역 통과 계수 (a0로 정규화)
+                        double w0 = 2.0 * kPi * spec.cutoff_hz / spec.sample_rate_hz;
+                        double alpha = std::sin(w0) / (2.0 * spec.q);
+                        double cos_w0 = std::cos(w0);
+                        double a0 = 1.0 + alpha;
+                        group.b0.push_back(static_cast<float>((1.0 - cos_w0) / 2.0 / a0));
+                        group.b1.push_back(static_cast<float>((1.0 - cos_w0) / a0));
+                        group.b2.push_back(static_cast<float>((1.0 - cos_w0) / 2.0 / a0));
+                        group.a1.push_back(static_cast<float>(-2.0 * cos_w0 / a0));
+                        group.a2.push_back(static_cast<float>((1.0 - alpha) / a0));
+                    } else {
+                        group.window.push_back(spec.window);
+                    }
+                }
+                devices.clear();
+                const size_t widest = std::max({ema.size(), lowpass.size(), median.size()});
+                xs.resize(widest);
+                ys.resize(widest);
+                window_values.resize(kMaxMedianWindow);
+            }
+
+            DeviceState& state(uint32_t device_id) {
+                auto it = devices.find(device_id);
+                if (it != devices.end()) {
+                    return it->second;
+                }
+                DeviceState& s = devices[device_id];
+                s.ema_y.assign(ema.size(), std::nanf(""));
+                s.z1.assign(lowpass.size(), std::nanf(""));
+                s.z2.assign(lowpass.size(), 0.0f);
+                s.lowpass_y.assign(lowpass.size(), std::nanf(""));
+                s.lowpass_unseeded = lowpass.size();
+                s.median_ring.assign(median.size() * kMaxMedianWindow, 0.0f);
+                s.median_count.assign(median.size(), 0);
+                s.median_pos.assign(median.size(), 0);
+                return s;
+            }
+
+            void gather(const Group& group, const SensorBatch& batch, size_t i) {
+                for (size_t f = 0; f < group.size(); ++f) {
+                    xs[f] = batch.columns[group.source[f]][i];
+                }
+            }
+
+            void scatter(const Group& group, SensorBatch& batch, size_t i) {
+                for (size_t f = 0; f < group.size(); ++f) {
+                    batch.columns[group.target[f]][i] = ys[f];
+                }
+            }
+
+            /// @brief EMA 한 스텝 (첫 유효 샘플은 그대로 출력)
+            /// @details 두 갈래를 모두 계산한 뒤 선택만 하므로 분기 없는 루프로 벡터화된다
+            ///          (한쪽 갈래에만 부동소수점 연산이 있으면 trapping-math 때문에 if 변환이 막힌다).
+            void stepEma(DeviceState& s) {
+                const size_t count = ema.size();
+                const float* alpha = ema.alpha.data();
+                const float* in = xs.data();
+                float* out = ys.data();
+                float* y = s.ema_y.data();
+                for (size_t f = 0; f < count; ++f) {
+                    const float x = in[f];
+                    const float prev = y[f];
+                    const float blended = prev + alpha[f] * (x - prev);
+                    const float updated = std::isnan(prev) ? x : blended;
+                    const float next = std::isnan(x) ? prev : updated;
+                    y[f] = next;
+                    out[f] = next;
+                }
+            }
+
+            /// @brief biquad 한 스텝 (전치 직접형 II). 첫 유효 샘플에서 정상 상태로 초기화해 시작 과도 응답 제거
+            /// @details 초기화는 아직 시작하지 않은 필터가 있을 때만 도는 별도 루프로 빼서
+            ///          본 루프(biquadStep)에는 분기가 남지 않게 한다.
+            void stepLowpass(DeviceState& s) {
+                const size_t count = lowpass.size();
+                const float* b0 = lowpass.b0.data();
+                const float* b1 = lowpass.b1.data();
+                const float* b2 = lowpass.b2.data();
+                const float* a1 = lowpass.a1.data();
+                const float* a2 = lowpass.a2.data();
+                const float* in = xs.data();
+                float* z1 = s.z1.data();
+                float* z2 = s.z2.data();
+                float* last = s.lowpass_y.data();
+                if (s.lowpass_unseeded > 0) {
+                    for (size_t f = 0; f < count; ++f) {
+                        if (std::isnan(z1[f]) && !std::isnan(in[f])) {
+                            z1[f] = in[f] * (1.0f - b0[f]);
+                            z2[f] = in[f] * (b2[f] - a2[f]);
+                            last[f] = 0.0f;             // biquadStep의 0 가중치 항이 NaN이 되지 않도록
+                            --s.lowpass_unseeded;
+                        }
+                    }
+                }
+                biquadStep(count, xs.data(), b0, b1, b2, a1, a2, z1, z2, last, ys.data());
+            }
+
+            /// @brief 중앙값 한 스텝 (창이 작아서 매번 부분 정렬)
+            void stepMedian(DeviceState& s) {
+                for (size_t f = 0; f < median.size(); ++f) {
+                    const size_t window = median.window[f];
+                    float* ring = s.median_ring.data() + f * kMaxMedianWindow;
+                    if (!std::isnan(xs[f])) {
+                        ring[s.median_pos[f]] = xs[f];
+                        s.median_pos[f] = (s.median_pos[f] + 1) % window;
+                        s.median_count[f] = std::min(s.median_count[f] + 1, window);
+                    }
+                    const size_t count = s.median_count[f];
+                    if (count == 0) {
+                        ys[f] = std::nanf("");
+                        continue;
+                    }
+                    std::copy(ring, ring + count, window_values.begin());
+                    auto mid = window_values.begin() + static_cast<std::ptrdiff_t>(count / 2);
+                    std::nth_element(window_values.begin(), mid, window_values.begin() + static_cast<std::ptrdiff_t>(count));
+                    ys[f] = *mid;
+                }
+            }
+        };
+
+        /// @brief FilterBank 메서드 구현
+        FilterBank::FilterBank(ChannelRegistry& registry) : pImpl(std::make_unique<Impl>(registry)) {}
+        FilterBank::~FilterBank() = default;
+        FilterBank::FilterBank(FilterBank&&) noexcept = default;
+        FilterBank& FilterBank::operator=(FilterBank&&) noexcept = default;
+
+        bool FilterBank::define(const FilterSpec& input, ChannelId& out_channel) {
+            FilterSpec spec = input;
+            if (spec.source >= kSensorChannelCount) {
+                pImpl->last_error = "source must be a base channel";
+                return false;
+            }
+            if (spec.name.empty()) {
+                spec.name = std::string(channelName(spec.source)) + "_" + filterTypeName(spec.type);
+            }
+            ChannelId existing;
+            if (pImpl->registry.find(spec.name, existing) && existing < kSensorChannelCount) {
+                pImpl->last_error = "cannot redefine base channel '" + spec.name + "'";
+                return false;
+            }
+            const bool known = pImpl->registry.find(spec.name, existing);
+            if (known && pImpl->registry.getOwner(existing) == ChannelOwner::DERIVED) {
+                pImpl->last_error = "'" + spec.name + "' is already a " + channelOwnerName(ChannelOwner::DERIVED);
+                return false;
+            }
+            if (!known && pImpl->registry.isFull()) {
+                pImpl->last_error = "channel limit reached (" + std::to_string(kMaxExtendedChannels) + " extended channels)";
+                return false;
+            }
+            switch (spec.type) {
+            case FilterType::EMA:
+                if (!(spec.alpha > 0.0f && spec.alpha <= 1.0f)) {
+                    pImpl->last_error = "alpha must be in (0, 1]";
+                    return false;
+                }
+                break;
+            case FilterType::LOWPASS:
+                if (!(spec.sample_rate_hz > 0.0f && spec.cutoff_hz > 0.0f && spec.cutoff_hz < spec.sample_rate_hz / 2.0f)) {
+                    pImpl->last_error = "cutoff must be between 0 and half the sample rate";
+                    return false;
+                }
+                if (!(spec.q > 0.0f)) {
+                    pImpl->last_error = "q must be positive";
+                    return false;
+                }
+                break;
+            case FilterType::MEDIAN:
+                if (spec.window < 3 || spec.window > kMaxMedianWindow || spec.window % 2 == 0) {
+                    pImpl->last_error = "median window must be odd, 3 to " + std::to_string(kMaxMedianWindow);
+                    return false;
+                }
+                break;
+            }
+
+            Impl::Definition def{spec, pImpl->registry.registerChannel(spec.name)};
+            auto& filters = pImpl->filters;
+            auto it = std::find_if(filters.begin(), filters.end(),
+                                   [&](const Impl::Definition& d) { return d.spec.name == spec.name; });
+            if (it == filters.end()) {
+                filters.push_back(def);
+            } else {
+                *it = def;
+            }
+            pImpl->registry.setOwner(def.channel, ChannelOwner::FILTER);
+            pImpl->rebuild();
+            out_channel = def.channel;
+            pImpl->last_error.clear();
+            return true;
+        }
+
+        bool FilterBank::remove(const std::string& name) {
+            auto& filters = pImpl->filters;
+            auto it = std::find_if(filters.begin(), filters.end(),
+                                   [&](const Impl::Definition& d) { return d.spec.name == name; });
+            if (it == filters.end()) {
+                return false;
+            }
+            pImpl->registry.setOwner(it->channel, ChannelOwner::NONE);
+            filters.erase(it);
+            pImpl->rebuild();
+            return true;
+        }
+
+        size_t FilterBank::size() const {
+            return pImpl->filters.size();
+        }
+
+        const FilterSpec& FilterBank::getSpec(size_t index) const {
+            return pImpl->filters[index].spec;
+        }
+
+        ChannelId FilterBank::getChannel(size_t index) const {
+            return pImpl->filters[index].channel;
+        }
+
+        void FilterBank::process(SensorBatch& batch) {
+            if (pImpl->filters.empty() || batch.empty()) {
+                return;
+            }
+            batch.ensureChannels(pImpl->registry.size());
+            Impl& impl = *pImpl;
+            Impl::DeviceState& s = impl.state(batch.device_id);
+            for (size_t i = 0; i < batch.size(); ++i) {
+                if (impl.ema.size() > 0) {
+                    impl.gather(impl.ema, batch, i);
+                    impl.stepEma(s);
+                    impl.scatter(impl.ema, batch, i);
+                }
+                if (impl.lowpass.size() > 0) {
+                    impl.gather(impl.lowpass, batch, i);
+                    impl.stepLowpass(s);
+                    impl.scatter(impl.lowpass, batch, i);
+                }
+                if (impl.median.size() > 0) {
+                    impl.gather(impl.median, batch, i);
+                    impl.stepMedian(s);
+                    impl.scatter(impl.median, batch, i);
+                }
+            }
+        }
+
+        void FilterBank::reset() {
+            pImpl->devices.clear();
+        }
+
+        std::string FilterBank::getLastError() const {
+            return pImpl->last_error;
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
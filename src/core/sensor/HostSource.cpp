@@ -0,0 +1,378 @@
+#include "core/sensor/HostSource.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            /// @brief 읽기 스레드가 쌓아둘 최대 시간 (read()가 불리지 않으면 넘는 샘플은 버림)
+            constexpr double kMaxPendingSeconds = 10.0;
+
+            /// @brief CPU 사용률을 새로 낼 최소 누적 틱 수 (USER_HZ=100이라 고속 샘플링에서는 차이가
+            ///        몇 틱뿐이어서 값이 크게 양자화됨. 그 전까지는 직전 값을 유지)
+            constexpr uint64_t kMinCpuTicks = 20;
+
+            /// @brief /proc/stat 첫 줄의 누적 시간 (jiffies)
+            struct CpuTimes {
+                uint64_t total = 0;
+                uint64_t idle = 0;
+            };
+
+#if defined(__linux__)
+            /// @brief 열린 파일을 처음부터 다시 읽음 (procfs/sysfs는 오프셋 0 읽기마다 새 값)
+            ssize_t readAt(int fd, char* buffer, size_t size) {
+                ssize_t n = pread(fd, buffer, size - 1, 0);
+                buffer[n > 0 ? n : 0] = '\0';
+                return n;
+            }
+
+            bool parseCpuTimes(const char* text, CpuTimes& out) {
+                // "cpu  user nice system idle iowait irq softirq steal guest guest_nice"
+                if (std::strncmp(text, "cpu ", 4) != 0) {
+                    return false;
+                }
+                const char* p = text + 4;
+                uint64_t fields[8] = {};
+                for (int i = 0; i < 8; ++i) {
+                    char* end;
+                    fields[i] = std::strtoull(p, &end, 10);
+                    if (end == p) {
+                        break;
+                    }
+                    p = end;
+                }
+                // guest는 user에 이미 포함되어 있으므로 steal까지만 합산
+                out.total = 0;
+                for (uint64_t field : fields) {
+                    out.total += field;
+                }
+                out.idle = fields[3] + fields[4];
+                return out.total > 0;
+            }
+
+            uint64_t meminfoField(const char* text, const char* key) {
+                const char* p = std::strstr(text, key);
+                return p ? std::strtoull(p + std::strlen(key), nullptr, 10) : 0;
+            }
+
+            bool startsWith(const char* text, const char* prefix) {
+                return std::strncmp(text, prefix, std::strlen(prefix)) == 0;
+            }
+#endif
+        }
+
+        /// @brief HostSource 구현 클래스 (Pimpl 패턴)
+        class HostSource::Impl {
+        public:
+            HostSourceConfig config;
+            std::string last_error;
+
+            std::vector<int> temp_fds;
+            int stat_fd = -1;
+            int meminfo_fd = -1;
+            CpuTimes last_cpu;
+            float cpu_usage = std::nanf("");
+
+            // 읽기 스레드 -> read() 전달용 배치
+            std::mutex pending_mutex;
+            SensorBatch pending;
+            size_t max_pending = 0;
+            size_t dropped = 0;
+
+            std::thread sampler;
+            std::mutex stop_mutex;
+            std::condition_variable stop_cv;
+            bool stop_requested = false;
+            std::atomic<bool> running{false};
+
+            explicit Impl(const HostSourceConfig& cfg) : config(cfg) {}
+
+            ~Impl() {
+                halt();
+            }
+
+            bool open() {
+#if defined(__linux__)
+                closeAll();
+                stat_fd = ::open((config.proc_root + "/stat").c_str(), O_RDONLY | O_CLOEXEC);
+                meminfo_fd = ::open((config.proc_root + "/meminfo").c_str(), O_RDONLY | O_CLOEXEC);
+                if (stat_fd < 0 || meminfo_fd < 0) {
+                    last_error = "cannot open " + config.proc_root + "/stat or /meminfo";
+                    closeAll();
+                    return false;
+                }
+                openHwmon();
+                char buffer[512];
+                if (readAt(stat_fd, buffer, sizeof(buffer)) <= 0 || !parseCpuTimes(buffer, last_cpu)) {
+                    last_error = "cannot parse " + config.proc_root + "/stat";
+                    closeAll();
+                    return false;
+                }
+                cpu_usage = std::nanf("");
+                last_error.clear();
+                return true;
+#else
+                last_error = "host source is only available on Linux";
+                return false;
+#endif
+            }
+
+#if defined(__linux__)
+            /// @brief hwmon*/temp*_input 을 모두 열어둠 (칩 이름 필터 적용)
+            void openHwmon() {
+                DIR* root = opendir(config.hwmon_root.c_str());
+                if (!root) {
+                    return;
+                }
+                std::vector<std::string> chips;
+                while (dirent* entry = readdir(root)) {
+                    if (startsWith(entry->d_name, "hwmon")) {
+                        chips.push_back(config.hwmon_root + "/" + entry->d_name);
+                    }
+                }
+                closedir(root);
+                std::sort(chips.begin(), chips.end());
+
+                for (const auto& chip : chips) {
+                    if (!config.hwmon_name.empty()) {
+                        char name[64] = {};
+                        int fd = ::open((chip + "/name").c_str(), O_RDONLY | O_CLOEXEC);
+                        if (fd < 0) {
+                            continue;
+                        }
+                        readAt(fd, name, sizeof(name));
+                        ::close(fd);
+                        name[std::strcspn(name, "\n")] = '\0';
+                        if (config.hwmon_name != name) {
+                            continue;
+                        }
+                    }
+                    DIR* dir = opendir(chip.c_str());
+                    if (!dir) {
+                        continue;
+                    }
+                    while (dirent* entry = readdir(dir)) {
+                        const char* file = entry->d_name;
+                        const size_t length = std::strlen(file);
+                        if (startsWith(file, "temp") && length > 6 && std::strcmp(file + length - 6, "_input") == 0) {
+                            int fd = ::open((chip + "/" + file).c_str(), O_RDONLY | O_CLOEXEC);
+                            if (fd >= 0) {
+                                temp_fds.push_back(fd);
+                            }
+                        }
+                    }
+                    closedir(dir);
+                }
+            }
+#endif
+
+            void closeAll() {
+#if defined(__linux__)
+                for (int fd : temp_fds) {
+                    ::close(fd);
+                }
+                if (stat_fd >= 0) {
+                    ::close(stat_fd);
+                }
+                if (meminfo_fd >= 0) {
+                    ::close(meminfo_fd);
+                }
+#endif
+                temp_fds.clear();
+                stat_fd = -1;
+                meminfo_fd = -1;
+            }
+
+            /// @brief 한 번 측정 (파일마다 pread 한 번)
+            void sample(SensorData& data) {
+                const float nan = std::nanf("");
+                data.humidity = nan;
+                data.pressure = nan;
+                data.light = nan;
+                data.temperature = nan;
+                data.cpu_usage = nan;
+                data.memory_usage = nan;
+                data.data_valid = true;
+#if defined(__linux__)
+                char buffer[512];
+                float hottest = nan;
+                for (int fd : temp_fds) {
+                    if (readAt(fd, buffer, 32) > 0) {
+                        const float celsius = static_cast<float>(std::strtol(buffer, nullptr, 10)) / 1000.0f;
+                        hottest = std::isnan(hottest) ? celsius : std::max(hottest, celsius);
+                    }
+                }
+                data.temperature = hottest;
+
+                CpuTimes cpu;
+                if (readAt(stat_fd, buffer, sizeof(buffer)) > 0 && parseCpuTimes(buffer, cpu)) {
+                    // 누적값끼리 나누면 부팅 이후 평균이 되므로 직전 측정과의 차이로 계산
+                    const uint64_t total = cpu.total - last_cpu.total;
+                    const uint64_t idle = cpu.idle - last_cpu.idle;
+                    if (cpu.total < last_cpu.total || cpu.idle < last_cpu.idle) {
+                        last_cpu = cpu;     // 카운터가 되돌아감 (CPU 핫플러그 등): 기준만 다시 잡음
+                    } else if (total >= kMinCpuTicks) {
+                        cpu_usage = 100.0f * static_cast<float>(total - std::min(idle, total)) / static_cast<float>(total);
+                        last_cpu = cpu;
+                    }
+                }
+                data.cpu_usage = cpu_usage;
+
+                if (readAt(meminfo_fd, buffer, sizeof(buffer)) > 0) {
+                    const uint64_t mem_total = meminfoField(buffer, "MemTotal:");
+                    const uint64_t mem_available = meminfoField(buffer, "MemAvailable:");
+                    if (mem_total > 0 && mem_available <= mem_total) {
+                        data.memory_usage = 100.0f * static_cast<float>(mem_total - mem_available) / static_cast<float>(mem_total);
+                    }
+                }
+#endif
+            }
+
+            void run(std::chrono::nanoseconds interval) {
+                auto deadline = std::chrono::steady_clock::now() + interval;
+                SensorData data;
+                while (true) {
+                    {
+                        std::unique_lock<std::mutex> lock(stop_mutex);
+                        if (stop_cv.wait_until(lock, deadline, [this] { return stop_requested; })) {
+                            return;
+                        }
+                    }
+                    sample(data);
+                    const Time::Timestamp t = Time::defaultClock().now();
+                    {
+                        std::lock_guard<std::mutex> lock(pending_mutex);
+                        if (pending.size() < max_pending) {
+                            pending.append(data, t);
+                        } else {
+                            dropped++;
+                        }
+                    }
+                    deadline += interval;
+                    const auto current = std::chrono::steady_clock::now();
+                    if (deadline < current) {
+                        deadline = current + interval;   // 밀린 주기는 건너뜀 (과거 시각 측정은 불가능)
+                    }
+                }
+            }
+
+            void halt() {
+                if (sampler.joinable()) {
+                    {
+                        std::lock_guard<std::mutex> lock(stop_mutex);
+                        stop_requested = true;
+                    }
+                    stop_cv.notify_all();
+                    sampler.join();
+                }
+                running = false;
+                closeAll();
+            }
+        };
+
+        /// @brief HostSource 메서드 구현
+        HostSource::HostSource(const HostSourceConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        HostSource::~HostSource() = default;
+
+        const char* HostSource::getType() const {
+            return "host";
+        }
+
+        bool HostSource::start() {
+            Impl& impl = *pImpl;
+            if (impl.running) {
+                return true;
+            }
+            if (!(impl.config.sample_rate_hz > 0.0f)) {
+                impl.last_error = "sample rate must be positive";
+                return false;
+            }
+            if (!impl.open()) {
+                return false;
+            }
+            {
+                std::lock_guard<std::mutex> lock(impl.pending_mutex);
+                impl.pending.clear();
+                impl.pending.device_id = device_id;
+                impl.max_pending = std::max<size_t>(static_cast<size_t>(impl.config.sample_rate_hz * kMaxPendingSeconds), 1);
+                impl.pending.reserve(std::min<size_t>(impl.max_pending, 1024));
+                impl.dropped = 0;
+            }
+            impl.stop_requested = false;
+            impl.running = true;
+            const auto interval = std::chrono::nanoseconds(
+                static_cast<int64_t>(Time::kNanosPerSecond / static_cast<double>(impl.config.sample_rate_hz)));
+            impl.sampler = std::thread([&impl, interval] { impl.run(interval); });
+            return true;
+        }
+
+        void HostSource::stop() {
+            pImpl->halt();
+        }
+
+        bool HostSource::isRunning() const {
+            return pImpl->running;
+        }
+
+        size_t HostSource::read(SensorBatch& out, Time::Timestamp now) {
+            (void)now;
+            Impl& impl = *pImpl;
+            std::lock_guard<std::mutex> lock(impl.pending_mutex);
+            const size_t count = impl.pending.size();
+            if (count == 0) {
+                return 0;
+            }
+            out.device_id = device_id;
+            for (size_t i = 0; i < count; ++i) {
+                out.append(impl.pending.sampleAt(i), impl.pending.timestamps_ns[i]);
+            }
+            impl.pending.clear();
+            return count;
+        }
+
+        std::string HostSource::getStatus() const {
+            if (!pImpl->running) {
+                return pImpl->last_error.empty() ? "stopped" : pImpl->last_error;
+            }
+            return std::to_string(pImpl->temp_fds.size()) + " hwmon sensors, " +
+                   std::to_string(static_cast<int>(pImpl->config.sample_rate_hz)) + " Hz";
+        }
+
+        std::vector<ValidationRule> HostSource::getValidationRules() const {
+            // SoC 접합부 한계는 보통 105~125 °C. hwmon 값은 정수 °C로 오래 머물 수 있어 고착 검사는 끔
+            return { { toChannelId(SensorChannel::TEMPERATURE), -40.0f, 125.0f, 0, true } };
+        }
+
+        void HostSource::setConfig(const HostSourceConfig& config) {
+            pImpl->config = config;
+        }
+
+        const HostSourceConfig& HostSource::getConfig() const {
+            return pImpl->config;
+        }
+
+        size_t HostSource::getTemperatureSensorCount() const {
+            return pImpl->temp_fds.size();
+        }
+
+        std::string HostSource::getLastError() const {
+            return pImpl->last_error;
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
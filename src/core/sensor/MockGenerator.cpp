@@ -0,0 +1,280 @@
+#include "core/sensor/MockGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            constexpr float kTwoPi = 6.28318530717958647692f;
+            constexpr uint64_t kGolden = 0x9E3779B97F4A7C15ull;
+
+            /// @brief splitmix64 마무리 함수 (카운터 -> 난수)
+            inline uint64_t mix(uint64_t x) {
+                x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+                x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+                return x ^ (x >> 31);
+            }
+
+            /// @brief 스트림 키: 시드/디바이스/채널/용도마다 독립된 난수 열
+            uint64_t streamKey(uint64_t seed, uint32_t device_id, ChannelId channel, uint32_t purpose) {
+                return mix(seed * kGolden ^ mix((static_cast<uint64_t>(device_id) << 24) ^
+                                                (static_cast<uint64_t>(channel) << 8) ^ purpose));
+            }
+
+            /// @brief [0, 1) 균등 난수 counter ~ counter+n-1
+            void fillUniform(float* out, size_t n, uint64_t key, uint64_t counter) {
+                for (size_t i = 0; i < n; ++i) {
+                    uint64_t bits = mix(key + (counter + i) * kGolden);
+                    out[i] = static_cast<float>(bits >> 40) * (1.0f / 16777216.0f);
+                }
+            }
+
+            /// @brief 근사 표준 정규 난수 (16비트 균등 4개 합, Irwin-Hall)
+            void fillNormal(float* out, size_t n, uint64_t key, uint64_t counter) {
+                constexpr float scale = 1.7320508f / 65536.0f;   // sqrt(12 / 4) / 2^16
+                for (size_t i = 0; i < n; ++i) {
+                    uint64_t bits = mix(key + (counter + i) * kGolden);
+                    uint32_t sum = static_cast<uint32_t>(bits & 0xFFFF) + static_cast<uint32_t>((bits >> 16) & 0xFFFF) +
+                                   static_cast<uint32_t>((bits >> 32) & 0xFFFF) + static_cast<uint32_t>(bits >> 48);
+                    out[i] = (static_cast<float>(sum) - 131070.0f) * scale;
+                }
+            }
+
+            enum Purpose : uint32_t {
+                PURPOSE_NOISE,
+                PURPOSE_STATE,
+                PURPOSE_LEVEL,
+                PURPOSE_PHASE
+            };
+        }
+
+        std::vector<SignalSpec> defaultMockSignals() {
+            std::vector<SignalSpec> signals(kSensorChannelCount);
+            SignalSpec& temperature = signals[0];
+            temperature.channel = toChannelId(SensorChannel::TEMPERATURE);
+            temperature.model = SignalModel::SINUSOID;
+            temperature.base = 25.0f;
+            temperature.amplitude = 3.0f;
+            temperature.period_s = 600.0f;
+            temperature.noise = 0.05f;
+
+            SignalSpec& humidity = signals[1];
+            humidity.channel = toChannelId(SensorChannel::HUMIDITY);
+            humidity.base = 55.0f;
+            humidity.amplitude = 0.5f;
+            humidity.period_s = 120.0f;
+            humidity.noise = 0.2f;
+            humidity.min = 0.0f;
+            humidity.max = 100.0f;
+
+            SignalSpec& pressure = signals[2];
+            pressure.channel = toChannelId(SensorChannel::PRESSURE);
+            pressure.base = 1013.0f;
+            pressure.amplitude = 0.05f;
+            pressure.period_s = 600.0f;
+            pressure.noise = 0.02f;
+
+            SignalSpec& light = signals[3];
+            light.channel = toChannelId(SensorChannel::LIGHT);
+            light.model = SignalModel::STEPS;
+            light.base = 300.0f;
+            light.amplitude = 250.0f;
+            light.rate_hz = 1.0f / 45.0f;
+            light.noise = 2.0f;
+            light.min = 0.0f;
+
+            SignalSpec& motion = signals[4];
+            motion.channel = toChannelId(SensorChannel::MOTION);
+            motion.model = SignalModel::EVENTS;
+            motion.rate_hz = 1.0f / 20.0f;
+            motion.duration_s = 4.0f;
+
+            SignalSpec& cpu = signals[5];
+            cpu.channel = toChannelId(SensorChannel::CPU_USAGE);
+            cpu.base = 35.0f;
+            cpu.amplitude = 3.0f;
+            cpu.period_s = 10.0f;
+            cpu.noise = 2.0f;
+            cpu.min = 0.0f;
+            cpu.max = 100.0f;
+
+            SignalSpec& memory = signals[6];
+            memory.channel = toChannelId(SensorChannel::MEMORY_USAGE);
+            memory.model = SignalModel::STEPS;
+            memory.base = 50.0f;
+            memory.amplitude = 15.0f;
+            memory.rate_hz = 1.0f / 30.0f;
+            memory.noise = 0.1f;
+            memory.min = 0.0f;
+            memory.max = 100.0f;
+            return signals;
+        }
+
+        /// @brief MockGenerator 구현 클래스 (Pimpl 패턴)
+        class MockGenerator::Impl {
+        public:
+            /// @brief 디바이스/신호 하나의 순차 상태
+            struct SignalState {
+                float value = std::nanf("");     // RANDOM_WALK 현재 값, STEPS 현재 단계
+                size_t remaining = 0;            // EVENTS 남은 샘플 수
+            };
+
+            struct DeviceState {
+                uint64_t counter = 0;            // 다음 샘플 번호
+                std::vector<SignalState> signals;
+            };
+
+            MockConfig config;
+            Time::Timestamp interval = 0;
+            std::unordered_map<uint32_t, DeviceState> devices;
+            std::vector<float> noise, draws;
+
+            explicit Impl(const MockConfig& cfg) {
+                configure(cfg);
+            }
+
+            void configure(const MockConfig& cfg) {
+                config = cfg;
+                if (!(config.sample_rate_hz > 0.0f)) {
+                    config.sample_rate_hz = 10.0f;
+                }
+                config.signals.erase(std::remove_if(config.signals.begin(), config.signals.end(),
+                                                    [](const SignalSpec& s) { return s.channel >= kSensorChannelCount; }),
+                                     config.signals.end());
+                interval = std::max<Time::Timestamp>(
+                    static_cast<Time::Timestamp>(std::llround(Time::kNanosPerSecond / config.sample_rate_hz)), 1);
+                devices.clear();
+            }
+
+            void run(const SignalSpec& spec, SignalState& state, uint32_t device_id, uint64_t counter,
+                     float* out, size_t n) {
+                const float dt = 1.0f / config.sample_rate_hz;
+                const uint64_t seed = config.seed;
+                noise.resize(n);
+                draws.resize(n);
+                fillNormal(noise.data(), n, streamKey(seed, device_id, spec.channel, PURPOSE_NOISE), counter);
+
+                switch (spec.model) {
+                case SignalModel::RANDOM_WALK: {
+                    // 이산 Ornstein-Uhlenbeck: x += (base - x) * dt / T + σ * sqrt(dt) * N
+                    fillNormal(draws.data(), n, streamKey(seed, device_id, spec.channel, PURPOSE_STATE), counter);
+                    const float pull = std::min(dt / std::max(spec.period_s, dt), 1.0f);
+                    const float step = spec.amplitude * std::sqrt(dt);
+                    float x = std::isnan(state.value) ? spec.base : state.value;
+                    for (size_t i = 0; i < n; ++i) {
+                        x += (spec.base - x) * pull + step * draws[i];
+                        out[i] = x;
+                    }
+                    state.value = x;
+                    break;
+                }
+                case SignalModel::SINUSOID: {
+                    float phase_draw;
+                    fillUniform(&phase_draw, 1, streamKey(seed, device_id, spec.channel, PURPOSE_PHASE), 0);
+                    const float omega = kTwoPi * dt / std::max(spec.period_s, dt);
+                    const double period_samples = std::max(spec.period_s, dt) / dt;
+                    // 위상은 한 주기 안으로 접어서 float 정밀도 유지
+                    const float start = static_cast<float>(std::fmod(static_cast<double>(counter), period_samples));
+                    const float phase = kTwoPi * phase_draw;
+                    for (size_t i = 0; i < n; ++i) {
+                        out[i] = spec.base + spec.amplitude * std::sin(omega * (start + static_cast<float>(i)) + phase);
+                    }
+                    break;
+                }
+                case SignalModel::STEPS: {
+                    fillUniform(draws.data(), n, streamKey(seed, device_id, spec.channel, PURPOSE_STATE), counter);
+                    const uint64_t level_key = streamKey(seed, device_id, spec.channel, PURPOSE_LEVEL);
+                    const float switch_probability = spec.rate_hz * dt;
+                    float level = state.value;
+                    if (std::isnan(level)) {
+                        float u;
+                        fillUniform(&u, 1, level_key, counter);
+                        level = spec.base + spec.amplitude * (2.0f * u - 1.0f);
+                    }
+                    for (size_t i = 0; i < n; ++i) {
+                        if (draws[i] < switch_probability) {
+                            float u;
+                            fillUniform(&u, 1, level_key, counter + i);
+                            level = spec.base + spec.amplitude * (2.0f * u - 1.0f);
+                        }
+                        out[i] = level;
+                    }
+                    state.value = level;
+                    break;
+                }
+                case SignalModel::EVENTS: {
+                    fillUniform(draws.data(), n, streamKey(seed, device_id, spec.channel, PURPOSE_STATE), counter);
+                    const float start_probability = spec.rate_hz * dt;
+                    const size_t duration = std::max<size_t>(static_cast<size_t>(std::lround(spec.duration_s / dt)), 1);
+                    size_t remaining = state.remaining;
+                    for (size_t i = 0; i < n; ++i) {
+                        remaining = (remaining == 0 && draws[i] < start_probability) ? duration : remaining;
+                        out[i] = remaining > 0 ? 1.0f : 0.0f;
+                        remaining -= remaining > 0 ? 1 : 0;
+                    }
+                    state.remaining = remaining;
+                    return;    // 0/1 신호에는 잡음을 더하지 않음
+                }
+                }
+
+                const float sigma = spec.noise;
+                const float lo = spec.min;
+                const float hi = spec.max;
+                for (size_t i = 0; i < n; ++i) {
+                    out[i] = std::min(std::max(out[i] + sigma * noise[i], lo), hi);
+                }
+            }
+        };
+
+        /// @brief MockGenerator 메서드 구현
+        MockGenerator::MockGenerator(const MockConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        MockGenerator::~MockGenerator() = default;
+        MockGenerator::MockGenerator(MockGenerator&&) noexcept = default;
+        MockGenerator& MockGenerator::operator=(MockGenerator&&) noexcept = default;
+
+        void MockGenerator::generate(SensorBatch& out, uint32_t device_id, Time::Timestamp start_ns, size_t count) {
+            if (count == 0) {
+                return;
+            }
+            Impl& impl = *pImpl;
+            const size_t first = out.size();
+            out.device_id = device_id;
+            out.timestamps_ns.reserve(first + count);
+            for (size_t i = 0; i < count; ++i) {
+                out.timestamps_ns.push_back(start_ns + static_cast<Time::Timestamp>(i) * impl.interval);
+            }
+            // 모델이 없는 채널과 확장 채널은 append와 같이 0으로 자리만 맞춤
+            for (auto& column : out.columns) {
+                column.resize(first + count, 0.0f);
+            }
+            out.quality.resize(first + count, 0);
+
+            Impl::DeviceState& device = impl.devices[device_id];
+            device.signals.resize(impl.config.signals.size());
+            for (size_t s = 0; s < impl.config.signals.size(); ++s) {
+                const SignalSpec& spec = impl.config.signals[s];
+                impl.run(spec, device.signals[s], device_id, device.counter, out.columns[spec.channel].data() + first, count);
+            }
+            device.counter += count;
+        }
+
+        void MockGenerator::setConfig(const MockConfig& config) {
+            pImpl->configure(config);
+        }
+
+        const MockConfig& MockGenerator::getConfig() const {
+            return pImpl->config;
+        }
+
+        Time::Timestamp MockGenerator::getInterval() const {
+            return pImpl->interval;
+        }
+
+        void MockGenerator::reset() {
+            pImpl->devices.clear();
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
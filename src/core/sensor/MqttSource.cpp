@@ -0,0 +1,703 @@
+#include "core/sensor/MqttSource.h"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            /// @brief MQTT 제어 패킷 종류 (고정 헤더 상위 4비트)
+            enum PacketType : uint8_t {
+                CONNECT = 1, CONNACK = 2, PUBLISH = 3, PUBACK = 4,
+                SUBSCRIBE = 8, SUBACK = 9, PINGREQ = 12, PINGRESP = 13, DISCONNECT = 14
+            };
+
+            /// @brief 한 번에 소켓에서 읽는 크기
+            constexpr size_t kReadChunk = 16 * 1024;
+
+            /// @brief 보내지 못하고 쌓인 바이트가 이보다 많으면 브로커가 막힌 것으로 보고 끊음
+            constexpr size_t kMaxOutbound = 256 * 1024;
+
+            /// @brief string_view로 바로 찾을 수 있는 문자열 해시 (토픽마다 std::string을 만들지 않기 위함)
+            struct TopicHash {
+                using is_transparent = void;
+                size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+            };
+
+            void putU16(std::vector<uint8_t>& out, size_t value) {
+                out.push_back(static_cast<uint8_t>(value >> 8));
+                out.push_back(static_cast<uint8_t>(value));
+            }
+
+            void putString(std::vector<uint8_t>& out, const std::string& text) {
+                putU16(out, text.size());
+                out.insert(out.end(), text.begin(), text.end());
+            }
+
+            /// @brief 고정 헤더 (종류/플래그 + 가변 길이 remaining length)
+            void putHeader(std::vector<uint8_t>& out, uint8_t first, size_t remaining) {
+                out.push_back(first);
+                do {
+                    uint8_t digit = static_cast<uint8_t>(remaining % 128);
+                    remaining /= 128;
+                    out.push_back(remaining > 0 ? static_cast<uint8_t>(digit | 0x80) : digit);
+                } while (remaining > 0);
+            }
+
+            uint16_t readU16(const uint8_t* p) {
+                return static_cast<uint16_t>((p[0] << 8) | p[1]);
+            }
+
+            /// @brief '/'로 나뉜 다음 세그먼트 (pos는 다음 세그먼트 시작으로 이동, 끝나면 npos)
+            std::string_view nextSegment(std::string_view topic, size_t& pos) {
+                const size_t slash = topic.find('/', pos);
+                std::string_view segment = topic.substr(pos, slash == std::string_view::npos ? std::string_view::npos : slash - pos);
+                pos = slash == std::string_view::npos ? std::string_view::npos : slash + 1;
+                return segment;
+            }
+
+            /// @brief 숫자 하나인 페이로드 해석 (앞뒤 공백 허용)
+            bool parseValue(std::string_view text, float& out) {
+                const auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+                while (!text.empty() && is_space(text.front())) {
+                    text.remove_prefix(1);
+                }
+                while (!text.empty() && is_space(text.back())) {
+                    text.remove_suffix(1);
+                }
+                if (!text.empty() && text.front() == '+') {
+                    text.remove_prefix(1);
+                }
+                if (text.empty()) {
+                    return false;
+                }
+                const auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+                return result.ec == std::errc() && result.ptr == text.data() + text.size();
+            }
+        }
+
+        /// @brief MqttSource 구현 클래스 (Pimpl 패턴)
+        class MqttSource::Impl {
+        public:
+            enum class State { IDLE, TCP_CONNECTING, WAIT_CONNACK, CONNECTED };
+
+            /// @brief '+'가 들어간 경로 (세그먼트가 비어 있으면 '+')
+            struct WildcardRoute {
+                std::vector<std::string> segments;
+                size_t route = 0;
+            };
+
+            /// @brief 디바이스별 누적 배치와 채널별 마지막 값
+            struct DeviceState {
+                SensorBatch batch;
+                std::vector<float> held;
+            };
+
+            MqttSourceConfig config;
+            std::string last_error;
+            MqttCounters counters;
+            bool enabled = false;
+            State state = State::IDLE;
+            int fd = -1;
+
+            std::vector<uint8_t> rx;
+            size_t rx_size = 0;
+            std::vector<uint8_t> tx;
+            size_t tx_sent = 0;
+            uint16_t next_packet_id = 1;
+
+            Time::Timestamp last_rx = 0;        // 실제 시계 기준 (keep-alive/재연결용)
+            Time::Timestamp last_tx = 0;
+            Time::Timestamp retry_at = 0;
+            Time::Timestamp last_tick = 0;      // 샘플 타임스탬프 구간 시작 (매니저 시계)
+            bool ticking = false;               // 첫 수집 주기에서 last_tick을 잡음
+
+            std::vector<MqttRoute> routes;      // start() 때의 경로 사본 (실행 중 setConfig와 무관)
+            std::unordered_map<std::string, size_t, TopicHash, std::equal_to<>> exact_routes;
+            std::vector<WildcardRoute> wildcard_routes;
+            size_t channel_count = kSensorChannelCount;
+
+            std::unordered_map<uint32_t, DeviceState> devices;
+            size_t tick_messages = 0;           // 이번 수집 주기에 받은 샘플 수 (타임스탬프 분배용)
+
+            explicit Impl(const MqttSourceConfig& cfg) : config(cfg) {}
+
+            ~Impl() {
+                disconnect();
+            }
+
+            /// @brief 경로 표 구성 (start()마다 한 번)
+            bool compileRoutes() {
+                routes = config.routes;
+                exact_routes.clear();
+                wildcard_routes.clear();
+                channel_count = kSensorChannelCount;
+                for (size_t i = 0; i < routes.size(); ++i) {
+                    const MqttRoute& route = routes[i];
+                    if (route.topic.empty() || route.topic.find('#') != std::string::npos) {
+                        last_error = "invalid route topic '" + route.topic + "'";
+                        return false;
+                    }
+                    if (route.channel >= kSensorChannelCount + kMaxExtendedChannels) {
+                        last_error = "route '" + route.topic + "' channel " + std::to_string(route.channel) + " out of range";
+                        return false;
+                    }
+                    channel_count = std::max<size_t>(channel_count, static_cast<size_t>(route.channel) + 1);
+                    if (route.topic.find('+') == std::string::npos) {
+                        if (!exact_routes.emplace(route.topic, i).second) {
+                            last_error = "duplicate route topic '" + route.topic + "'";
+                            return false;
+                        }
+                        continue;
+                    }
+                    for (const auto& other : wildcard_routes) {
+                        if (routes[other.route].topic == route.topic) {
+                            last_error = "duplicate route topic '" + route.topic + "'";
+                            return false;
+                        }
+                    }
+                    WildcardRoute compiled;
+                    compiled.route = i;
+                    size_t pos = 0;
+                    while (pos != std::string_view::npos) {
+                        std::string_view segment = nextSegment(route.topic, pos);
+                        if (segment == "+") {
+                            segment = {};
+                        } else if (segment.find('+') != std::string_view::npos) {
+                            last_error = "invalid route topic '" + route.topic + "'";
+                            return false;
+                        }
+                        compiled.segments.emplace_back(segment);
+                    }
+                    wildcard_routes.push_back(std::move(compiled));
+                }
+                if (exact_routes.empty() && wildcard_routes.empty()) {
+                    last_error = "no routes configured";
+                    return false;
+                }
+                return true;
+            }
+
+            /// @brief 토픽 -> 경로 (없으면 nullptr)
+            const MqttRoute* match(std::string_view topic) const {
+                auto exact = exact_routes.find(topic);
+                if (exact != exact_routes.end()) {
+                    return &routes[exact->second];
+                }
+                for (const auto& wildcard : wildcard_routes) {
+                    size_t pos = 0;
+                    size_t level = 0;
+                    bool matched = true;
+                    for (; level < wildcard.segments.size() && pos != std::string_view::npos; ++level) {
+                        const std::string_view segment = nextSegment(topic, pos);
+                        const std::string& expected = wildcard.segments[level];
+                        if (!expected.empty() && segment != expected) {
+                            matched = false;
+                            break;
+                        }
+                    }
+                    if (matched && level == wildcard.segments.size() && pos == std::string_view::npos) {
+                        return &routes[wildcard.route];
+                    }
+                }
+                return nullptr;
+            }
+
+            bool resolveDevice(const MqttRoute& route, std::string_view topic, uint32_t& device) const {
+                if (route.device_level < 0) {
+                    device = route.device_id;
+                    return true;
+                }
+                size_t pos = 0;
+                std::string_view segment;
+                for (int level = 0; level <= route.device_level; ++level) {
+                    if (pos == std::string_view::npos) {
+                        return false;
+                    }
+                    segment = nextSegment(topic, pos);
+                }
+                const auto result = std::from_chars(segment.data(), segment.data() + segment.size(), device);
+                return result.ec == std::errc() && result.ptr == segment.data() + segment.size();
+            }
+
+            /// @brief 샘플 한 줄 추가 (타임스탬프 자리에는 우선 이번 주기 안의 순번을 넣어둠)
+            void addSample(uint32_t device, ChannelId channel, float value) {
+                auto it = devices.find(device);
+                if (it == devices.end()) {
+                    it = devices.emplace(device, DeviceState()).first;
+                    it->second.batch.device_id = device;
+                    it->second.batch.ensureChannels(channel_count);
+                    it->second.held.assign(channel_count, std::nanf(""));
+                }
+                DeviceState& state = it->second;
+                state.held[channel] = value;
+                SensorBatch& batch = state.batch;
+                batch.timestamps_ns.push_back(static_cast<Time::Timestamp>(tick_messages++));
+                batch.quality.push_back(0);
+                for (size_t ch = 0; ch < batch.columns.size(); ++ch) {
+                    batch.columns[ch].push_back(ch < state.held.size() ? state.held[ch] : std::nanf(""));
+                }
+            }
+
+            /// @brief 순번 -> (last_tick, now] 구간에 고르게 나눈 타임스탬프
+            void stampTick(Time::Timestamp now) {
+                if (tick_messages == 0) {
+                    last_tick = now;
+                    return;
+                }
+                const Time::Timestamp count = static_cast<Time::Timestamp>(tick_messages);
+                const Time::Timestamp span = std::max<Time::Timestamp>(now - last_tick, count);
+                for (auto& entry : devices) {
+                    for (auto& t : entry.second.batch.timestamps_ns) {
+                        t = now - span + span * (t + 1) / count;
+                    }
+                }
+                tick_messages = 0;
+                last_tick = now;
+            }
+
+            void fail(const std::string& message) {
+                last_error = message;
+                disconnect();
+                retry_at = Time::defaultClock().now() + config.reconnect_ns;
+            }
+
+            void disconnect() {
+#ifndef _WIN32
+                if (fd >= 0) {
+                    if (state == State::CONNECTED) {
+                        const uint8_t packet[2] = { DISCONNECT << 4, 0 };
+                        ::send(fd, packet, sizeof(packet), MSG_NOSIGNAL);
+                    }
+                    ::close(fd);
+                }
+#endif
+                fd = -1;
+                state = State::IDLE;
+                rx_size = 0;
+                tx.clear();
+                tx_sent = 0;
+            }
+
+#ifndef _WIN32
+            /// @brief 논블로킹 TCP 연결 시작 (주소 해석은 블로킹이므로 IP나 hosts 항목을 권장)
+            void beginConnect() {
+                addrinfo hints{};
+                hints.ai_family = AF_UNSPEC;
+                hints.ai_socktype = SOCK_STREAM;
+                addrinfo* addresses = nullptr;
+                const std::string port = std::to_string(config.port);
+                if (getaddrinfo(config.host.c_str(), port.c_str(), &hints, &addresses) != 0 || !addresses) {
+                    fail("cannot resolve " + config.host);
+                    return;
+                }
+                fd = ::socket(addresses->ai_family, addresses->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, addresses->ai_protocol);
+                if (fd < 0) {
+                    freeaddrinfo(addresses);
+                    fail(std::string("socket: ") + std::strerror(errno));
+                    return;
+                }
+                const int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                const int result = ::connect(fd, addresses->ai_addr, addresses->ai_addrlen);
+                freeaddrinfo(addresses);
+                if (result != 0 && errno != EINPROGRESS) {
+                    fail("connect " + config.host + ":" + port + ": " + std::strerror(errno));
+                    return;
+                }
+                state = State::TCP_CONNECTING;
+                last_rx = last_tx = Time::defaultClock().now();
+            }
+
+            void sendConnect() {
+                const bool has_user = !config.username.empty();
+                const bool has_password = has_user && !config.password.empty();
+                size_t remaining = 10 + 2 + config.client_id.size();
+                if (has_user) {
+                    remaining += 2 + config.username.size();
+                }
+                if (has_password) {
+                    remaining += 2 + config.password.size();
+                }
+                putHeader(tx, CONNECT << 4, remaining);
+                putString(tx, "MQTT");
+                tx.push_back(4);                                    // 프로토콜 레벨 3.1.1
+                tx.push_back(static_cast<uint8_t>(0x02 | (has_user ? 0x80 : 0) | (has_password ? 0x40 : 0)));
+                putU16(tx, config.keep_alive_s);
+                putString(tx, config.client_id);
+                if (has_user) {
+                    putString(tx, config.username);
+                }
+                if (has_password) {
+                    putString(tx, config.password);
+                }
+                state = State::WAIT_CONNACK;
+            }
+
+            /// @brief 경로 토픽 전체를 SUBSCRIBE 하나로 구독 (같은 토픽은 한 번만)
+            void sendSubscribe() {
+                std::vector<const std::string*> topics;
+                for (const auto& route : routes) {
+                    const bool seen = std::any_of(topics.begin(), topics.end(),
+                                                  [&](const std::string* topic) { return *topic == route.topic; });
+                    if (!seen) {
+                        topics.push_back(&route.topic);
+                    }
+                }
+                size_t remaining = 2;
+                for (const std::string* topic : topics) {
+                    remaining += 2 + topic->size() + 1;
+                }
+                putHeader(tx, (SUBSCRIBE << 4) | 0x02, remaining);
+                putU16(tx, next_packet_id++);
+                if (next_packet_id == 0) {
+                    next_packet_id = 1;
+                }
+                for (const std::string* topic : topics) {
+                    putString(tx, *topic);
+                    tx.push_back(std::min<uint8_t>(config.qos, 1));
+                }
+            }
+
+            /// @brief PUBLISH를 수신 버퍼 안에서 바로 해석
+            void handlePublish(uint8_t flags, const uint8_t* body, size_t size) {
+                const uint8_t qos = (flags >> 1) & 0x03;
+                if (size < 2) {
+                    fail("malformed PUBLISH");
+                    return;
+                }
+                const size_t topic_size = readU16(body);
+                size_t offset = 2 + topic_size;
+                if (qos > 0) {
+                    offset += 2;
+                }
+                if (offset > size) {
+                    fail("malformed PUBLISH");
+                    return;
+                }
+                const std::string_view topic(reinterpret_cast<const char*>(body + 2), topic_size);
+                if (qos == 1) {
+                    const uint8_t ack[4] = { PUBACK << 4, 2, body[2 + topic_size], body[3 + topic_size] };
+                    tx.insert(tx.end(), ack, ack + sizeof(ack));
+                }
+                const std::string_view payload(reinterpret_cast<const char*>(body + offset), size - offset);
+
+                const MqttRoute* route = match(topic);
+                uint32_t device = 0;
+                if (!route || !resolveDevice(*route, topic, device)) {
+                    counters.unrouted++;
+                    return;
+                }
+                float value;
+                if (!parseValue(payload, value)) {
+                    counters.bad_payloads++;
+                    return;
+                }
+                addSample(device, route->channel, value);
+                counters.messages++;
+            }
+
+            /// @brief 완성된 패킷 하나 처리
+            void handlePacket(uint8_t header, const uint8_t* body, size_t size) {
+                switch (header >> 4) {
+                case CONNACK:
+                    if (state != State::WAIT_CONNACK || size < 2 || body[1] != 0) {
+                        fail(size >= 2 ? "connection refused (code " + std::to_string(body[1]) + ")" : "malformed CONNACK");
+                        return;
+                    }
+                    state = State::CONNECTED;
+                    counters.connects++;
+                    last_error.clear();
+                    sendSubscribe();
+                    break;
+                case PUBLISH:
+                    handlePublish(header & 0x0F, body, size);
+                    break;
+                case SUBACK:
+                    for (size_t i = 2; i < size; ++i) {
+                        if (body[i] == 0x80) {
+                            last_error = "broker rejected a subscription";
+                        }
+                    }
+                    break;
+                case PINGRESP:
+                case PUBACK:
+                    break;
+                default:
+                    fail("unexpected packet type " + std::to_string(header >> 4));
+                    break;
+                }
+            }
+
+            /// @brief 수신 버퍼에서 완성된 패킷을 모두 처리
+            void parsePackets() {
+                size_t offset = 0;
+                while (fd >= 0 && rx_size - offset >= 2) {
+                    size_t remaining = 0;
+                    size_t header_size = 1;
+                    bool complete = false;
+                    for (int shift = 0; shift < 28; shift += 7) {
+                        if (offset + header_size >= rx_size) {
+                            break;
+                        }
+                        const uint8_t digit = rx[offset + header_size++];
+                        remaining |= static_cast<size_t>(digit & 0x7F) << shift;
+                        if ((digit & 0x80) == 0) {
+                            complete = true;
+                            break;
+                        }
+                    }
+                    if (!complete) {
+                        if (header_size > 4) {
+                            fail("malformed remaining length");
+                            return;
+                        }
+                        break;
+                    }
+                    if (remaining > config.max_packet_bytes) {
+                        fail("packet of " + std::to_string(remaining) + " bytes exceeds limit");
+                        return;
+                    }
+                    if (rx_size - offset < header_size + remaining) {
+                        break;
+                    }
+                    handlePacket(rx[offset], rx.data() + offset + header_size, remaining);
+                    offset += header_size + remaining;
+                }
+                if (fd < 0) {
+                    return;
+                }
+                if (offset > 0) {
+                    std::memmove(rx.data(), rx.data() + offset, rx_size - offset);
+                    rx_size -= offset;
+                }
+            }
+
+            void receive() {
+                while (fd >= 0) {
+                    if (rx.size() - rx_size < kReadChunk) {
+                        rx.resize(std::max(rx.size() * 2, rx_size + kReadChunk));
+                    }
+                    const ssize_t n = ::recv(fd, rx.data() + rx_size, rx.size() - rx_size, 0);
+                    if (n > 0) {
+                        rx_size += static_cast<size_t>(n);
+                        counters.bytes += static_cast<uint64_t>(n);
+                        last_rx = Time::defaultClock().now();
+                        parsePackets();
+                        continue;
+                    }
+                    if (n == 0) {
+                        fail("broker closed the connection");
+                    } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        fail(std::string("recv: ") + std::strerror(errno));
+                    }
+                    return;
+                }
+            }
+
+            void flush() {
+                while (fd >= 0 && tx_sent < tx.size()) {
+                    const ssize_t n = ::send(fd, tx.data() + tx_sent, tx.size() - tx_sent, MSG_NOSIGNAL);
+                    if (n > 0) {
+                        tx_sent += static_cast<size_t>(n);
+                        last_tx = Time::defaultClock().now();
+                        continue;
+                    }
+                    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        fail(std::string("send: ") + std::strerror(errno));
+                        return;
+                    }
+                    break;
+                }
+                if (tx_sent == tx.size()) {
+                    tx.clear();
+                    tx_sent = 0;
+                } else if (tx.size() - tx_sent > kMaxOutbound) {
+                    fail("broker is not reading");
+                }
+            }
+#endif
+
+            /// @brief 수집 주기마다 한 번: 연결 진행, 수신 처리, keep-alive, 송신
+            void pump(Time::Timestamp now) {
+                if (!ticking) {
+                    last_tick = now;
+                    ticking = true;
+                }
+#ifndef _WIN32
+                if (!enabled) {
+                    return;
+                }
+                const Time::Timestamp real_now = Time::defaultClock().now();
+                if (state == State::IDLE) {
+                    if (real_now < retry_at) {
+                        stampTick(now);
+                        return;
+                    }
+                    beginConnect();
+                }
+                if (state == State::TCP_CONNECTING) {
+                    pollfd pfd{ fd, POLLOUT, 0 };
+                    if (::poll(&pfd, 1, 0) <= 0) {
+                        stampTick(now);
+                        return;
+                    }
+                    int error = 0;
+                    socklen_t length = sizeof(error);
+                    getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length);
+                    if (error != 0) {
+                        fail("connect " + config.host + ":" + std::to_string(config.port) + ": " + std::strerror(error));
+                        stampTick(now);
+                        return;
+                    }
+                    sendConnect();
+                }
+                receive();
+                if (fd >= 0 && config.keep_alive_s > 0) {
+                    const Time::Timestamp keep_alive = static_cast<Time::Timestamp>(config.keep_alive_s) * Time::kNanosPerSecond;
+                    if (real_now - last_rx > keep_alive * 3 / 2) {
+                        fail("keep-alive timeout");
+                    } else if (state == State::CONNECTED && real_now - last_tx >= keep_alive / 2 && tx.empty()) {
+                        tx.push_back(static_cast<uint8_t>(PINGREQ << 4));
+                        tx.push_back(0);
+                    }
+                }
+                flush();
+#endif
+                stampTick(now);
+            }
+        };
+
+        /// @brief MqttSource 메서드 구현
+        MqttSource::MqttSource(const MqttSourceConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        MqttSource::~MqttSource() = default;
+
+        const char* MqttSource::getType() const {
+            return "mqtt";
+        }
+
+        bool MqttSource::start() {
+            Impl& impl = *pImpl;
+            if (impl.enabled) {
+                return true;
+            }
+#ifdef _WIN32
+            impl.last_error = "mqtt source is only available on POSIX systems";
+            return false;
+#else
+            if (!impl.compileRoutes()) {
+                return false;
+            }
+            impl.devices.clear();
+            impl.tick_messages = 0;
+            impl.ticking = false;
+            impl.retry_at = 0;
+            impl.last_error.clear();
+            impl.enabled = true;
+            return true;
+#endif
+        }
+
+        void MqttSource::stop() {
+            pImpl->enabled = false;
+            pImpl->disconnect();
+        }
+
+        bool MqttSource::isRunning() const {
+            return pImpl->enabled;
+        }
+
+        size_t MqttSource::read(SensorBatch& out, Time::Timestamp now) {
+            Impl& impl = *pImpl;
+            impl.pump(now);
+            size_t added = 0;
+            for (auto& entry : impl.devices) {
+                SensorBatch& batch = entry.second.batch;
+                if (entry.first == device_id && !batch.empty()) {
+                    out.device_id = device_id;
+                    out.ensureChannels(batch.channelCount());
+                    for (size_t i = 0; i < batch.size(); ++i) {
+                        out.timestamps_ns.push_back(batch.timestamps_ns[i]);
+                        out.quality.push_back(0);
+                        for (size_t ch = 0; ch < out.columns.size(); ++ch) {
+                            out.columns[ch].push_back(ch < batch.columns.size() ? batch.columns[ch][i] : std::nanf(""));
+                        }
+                    }
+                    added = batch.size();
+                }
+                batch.clear();
+            }
+            return added;
+        }
+
+        void MqttSource::collect(Time::Timestamp now, SensorBatch& scratch, const BatchSink& sink) {
+            Impl& impl = *pImpl;
+            impl.pump(now);
+            for (auto& entry : impl.devices) {
+                SensorBatch& batch = entry.second.batch;
+                if (batch.empty()) {
+                    continue;
+                }
+                // 버퍼를 맞바꿔 넘기므로 복사 없이 전달되고, 비워진 scratch 용량은 다음 주기에 이 디바이스가 다시 씀
+                std::swap(scratch, batch);
+                sink(scratch);
+                std::swap(scratch, batch);
+                batch.clear();
+                batch.device_id = entry.first;
+            }
+        }
+
+        std::string MqttSource::getStatus() const {
+            const Impl& impl = *pImpl;
+            if (!impl.enabled) {
+                return impl.last_error.empty() ? "stopped" : impl.last_error;
+            }
+            const std::string endpoint = impl.config.host + ":" + std::to_string(impl.config.port);
+            switch (impl.state) {
+            case Impl::State::CONNECTED:
+                return "connected to " + endpoint + ", " + std::to_string(impl.devices.size()) + " devices, " +
+                       std::to_string(impl.counters.messages) + " messages";
+            case Impl::State::IDLE:
+                return impl.last_error.empty() ? "waiting to connect" : "retrying: " + impl.last_error;
+            default:
+                return "connecting to " + endpoint;
+            }
+        }
+
+        bool MqttSource::isConnected() const {
+            return pImpl->state == Impl::State::CONNECTED;
+        }
+
+        void MqttSource::setConfig(const MqttSourceConfig& config) {
+            pImpl->config = config;
+        }
+
+        const MqttSourceConfig& MqttSource::getConfig() const {
+            return pImpl->config;
+        }
+
+        MqttCounters MqttSource::getCounters() const {
+            return pImpl->counters;
+        }
+
+        std::string MqttSource::getLastError() const {
+            return pImpl->last_error;
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
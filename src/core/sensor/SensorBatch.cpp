@@ -0,0 +1,132 @@
+#include "core/sensor/SensorBatch.h"
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        const char* channelName(ChannelId channel) {
+            switch (static_cast<SensorChannel>(channel)) {
+            case SensorChannel::TEMPERATURE:  return "temperature";
+            case SensorChannel::HUMIDITY:     return "humidity";
+            case SensorChannel::PRESSURE:     return "pressure";
+            case SensorChannel::LIGHT:        return "light";
+            case SensorChannel::MOTION:       return "motion_detected";
+            case SensorChannel::CPU_USAGE:    return "cpu_usage";
+            case SensorChannel::MEMORY_USAGE: return "memory_usage";
+            default:                          return "channel";
+            }
+        }
+
+        const char* channelOwnerName(ChannelOwner owner) {
+            switch (owner) {
+            case ChannelOwner::BASE:    return "base channel";
+            case ChannelOwner::FILTER:  return "filter output";
+            case ChannelOwner::DERIVED: return "derived channel";
+            default:                    return "channel";
+            }
+        }
+
+        /// @brief ChannelRegistry 메서드 구현
+        ChannelRegistry::ChannelRegistry() {
+            for (size_t ch = 0; ch < kSensorChannelCount; ++ch) {
+                setOwner(registerChannel(channelName(static_cast<ChannelId>(ch))), ChannelOwner::BASE);
+            }
+        }
+
+        ChannelId ChannelRegistry::registerChannel(const std::string& name) {
+            auto it = ids.find(name);
+            if (it != ids.end()) {
+                return it->second;
+            }
+            ChannelId id = static_cast<ChannelId>(names.size());
+            names.push_back(name);
+            ids[name] = id;
+            owners.push_back(ChannelOwner::NONE);
+            return id;
+        }
+
+        bool ChannelRegistry::find(const std::string& name, ChannelId& out) const {
+            auto it = ids.find(name);
+            if (it == ids.end()) {
+                return false;
+            }
+            out = it->second;
+            return true;
+        }
+
+        const std::string& ChannelRegistry::getName(ChannelId channel) const {
+            static const std::string unknown = "channel";
+            return channel < names.size() ? names[channel] : unknown;
+        }
+
+        ChannelOwner ChannelRegistry::getOwner(ChannelId channel) const {
+            return channel < owners.size() ? owners[channel] : ChannelOwner::NONE;
+        }
+
+        void ChannelRegistry::setOwner(ChannelId channel, ChannelOwner owner) {
+            if (channel < owners.size()) {
+                owners[channel] = owner;
+            }
+        }
+
+        /// @brief SensorBatch 메서드 구현
+        SensorBatch::SensorBatch() : columns(kSensorChannelCount) {}
+
+        void SensorBatch::ensureChannels(size_t count) {
+            if (columns.size() >= count) {
+                return;
+            }
+            columns.resize(count);
+            for (auto& col : columns) {
+                col.resize(timestamps_ns.size(), 0.0f);
+            }
+        }
+
+        void SensorBatch::append(const SensorData& data, Time::Timestamp timestamp_ns) {
+            timestamps_ns.push_back(timestamp_ns);
+            quality.resize(timestamps_ns.size(), 0);
+            column(SensorChannel::TEMPERATURE).push_back(data.temperature);
+            column(SensorChannel::HUMIDITY).push_back(data.humidity);
+            column(SensorChannel::PRESSURE).push_back(data.pressure);
+            column(SensorChannel::LIGHT).push_back(data.light);
+            column(SensorChannel::MOTION).push_back(data.motion_detected ? 1.0f : 0.0f);
+            column(SensorChannel::CPU_USAGE).push_back(data.cpu_usage);
+            column(SensorChannel::MEMORY_USAGE).push_back(data.memory_usage);
+
+            // 확장 채널은 나중에 채워지므로 자리만 맞춰둔다
+            for (size_t ch = kSensorChannelCount; ch < columns.size(); ++ch) {
+                columns[ch].push_back(0.0f);
+            }
+        }
+
+        SensorData SensorBatch::sampleAt(size_t index) const {
+            SensorData data;
+            data.temperature = column(SensorChannel::TEMPERATURE)[index];
+            data.humidity = column(SensorChannel::HUMIDITY)[index];
+            data.pressure = column(SensorChannel::PRESSURE)[index];
+            data.light = column(SensorChannel::LIGHT)[index];
+            data.motion_detected = column(SensorChannel::MOTION)[index] != 0.0f;
+            data.cpu_usage = column(SensorChannel::CPU_USAGE)[index];
+            data.memory_usage = column(SensorChannel::MEMORY_USAGE)[index];
+            data.data_valid = true;
+            data.quality = index < quality.size() ? quality[index] : 0;
+            return data;
+        }
+
+        void SensorBatch::reserve(size_t samples) {
+            timestamps_ns.reserve(samples);
+            quality.reserve(samples);
+            for (auto& col : columns) {
+                col.reserve(samples);
+            }
+        }
+
+        void SensorBatch::clear() {
+            timestamps_ns.clear();
+            quality.clear();
+            for (auto& col : columns) {
+                col.clear();
+            }
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
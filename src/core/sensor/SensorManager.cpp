@@ -1,12 +1,28 @@
 #include "core/sensor/SensorManager.h"
-#include "core/network/NetworkClient.h"
-#include <random>
+#include "core/sensor/SensorBatch.h"
+#include "core/sensor/Calibration.h"
+#include "core/sensor/DerivedChannels.h"
+#include "core/sensor/FilterBank.h"
+#include "core/sensor/MockGenerator.h"
+#include "core/sensor/SensorSource.h"
+#include "core/sensor/Validation.h"
+#include "core/network/RaspberryPiSource.h"
+#include "core/alert/AlertEngine.h"
+#include "core/event/EventBus.h"
+#include "core/ipc/SharedRing.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
 
 namespace DachshundEngine {
     namespace Sensor {
         
         /// @brief ConnectionStatus 구조체 메서드 구현
-        void ConnectionStatus::updateStatus(bool connected, float current_time) {
+        void ConnectionStatus::updateStatus(bool connected, Time::Timestamp current_time) {
             is_connected = connected;
             if(connected) {
                 status_message = "Connected to Raspberry Pi";
@@ -23,14 +39,14 @@ namespace DachshundEngine {
         
         void ConnectionStatus::resetConnectionStatus() {
             is_connected = false;
-            last_data_time = 0.0f;
+            last_data_time = 0;
             reconnect_attempts = 0;
             status_message = "Not Connected";
         }
 
         /// @brief SensorData 구조체 메서드 구현
         bool SensorData::isValid() const {
-            return data_valid;
+            return data_valid && quality == 0;
         }
 
         void SensorData::copyFrom(const SensorData& other) {
@@ -46,71 +62,313 @@ namespace DachshundEngine {
             cpu_usage = 0.0f;
             memory_usage = 0.0f;
             data_valid = false;
+            quality = 0;
         }
 
         /// @brief SensorDataManager 클래스의 구현 세부정보를 포함하는 내부 클래스
         class SensorDataManager::Impl {
             public:
                 SensorMode current_mode;
-                bool connected;
-                std::string raspberry_pi_ip;
-                int raspberry_pi_port;
 
-                // 네트워크 클라이언트
-                std::unique_ptr<Network::NetworkClient> network_client;
+                // 데이터 소스 (내장 목/라즈베리파이 소스 + addSource로 추가한 소스). 모드는 최신 샘플을
+                // 제공할 내장 소스를 고르고, 실행 중인 소스는 모두 수집 주기마다 읽혀 파이프라인에 들어간다
+                struct SourceEntry {
+                    SourceId id;
+                    std::unique_ptr<SensorSource> source;
+                };
+                std::vector<SourceEntry> sources;
+                SourceId next_source_id = kRaspberryPiSourceId + 1;
+                std::string last_source_error;                 // 마지막 addSource 시작 실패 이유
+                MockSource* mock_source = nullptr;
+                Network::RaspberryPiSource* pi_source = nullptr;
                 SensorData latest_sensor_data;
 
-                // 목 데이터 생성기
-                std::random_device rd;
-                std::mt19937 gen{rd()};
-                std::uniform_real_distribution<> temp_dist{20.0, 30.0};
-                std::uniform_real_distribution<> humidity_dist{40.0, 80.0};
-                std::uniform_real_distribution<> pressure_dist{1000.0, 1020.0};
-                std::uniform_real_distribution<> light_dist{0.0, 100.0};
-                std::uniform_real_distribution<> cpu_dist{10.0, 90.0};
-                std::uniform_real_distribution<> mem_dist{30.0, 70.0};
-                std::uniform_int_distribution<> motion_dist{0, 1};
+                // 수집 파이프라인: 샘플을 배치로 모은 뒤 보정, 검증, 평활 필터, 파생 채널 계산, 규칙 평가 순으로 처리
+                SensorBatch ingest_batch;
+                std::shared_ptr<const CalibrationTable> calibration;
+                mutable std::mutex calibration_mutex;   // 포인터 복사 동안만 잡음 (표 생성/해제는 잠금 밖)
+                DataValidator validator;
+                ChannelRegistry channel_registry;
+                FilterBank filter_bank{channel_registry};
+                DerivedChannelSet derived_channels{channel_registry};
+                Alert::AlertEngine alert_engine;
+                std::vector<Alert::AlertEvent> pending_alerts;
+                std::function<void(const Alert::AlertEvent&)> onAlert;
+                std::vector<std::pair<size_t, BatchProcessor>> batch_processors;
+                size_t next_processor_id = 0;
+
+                // 타임스탬프 공급원
+                std::shared_ptr<Time::Clock> clock;
+
+                // 이벤트 버스 (선택)
+                Event::EventBus* event_bus = nullptr;
+                Event::SubscriberId command_subscriber = Event::EventBus::kInvalidSubscriber;
+
+                // 공유 메모리 내보내기 (선택). 채널이 등록되면 이름 표를 다시 씀
+                Ipc::SharedRingWriter* shared_ring = nullptr;
+                size_t shared_ring_channels = 0;
+
+                // 수집 주기. 파이프라인 전체(수집, 모듈, 배치 처리기)는 pipeline_mutex 아래에서만 돈다
+                mutable std::recursive_mutex pipeline_mutex;
+                Time::Timestamp update_interval = 100 * Time::kNanosPerMilli;
+                Time::Timestamp next_update = 0;
+                bool update_started = false;
+
+                // 샘플링 스레드 (producer_mutex는 깨우기/정지 신호 전용)
+                std::thread producer;
+                std::mutex producer_mutex;
+                std::condition_variable producer_cv;
+                bool producer_stop = false;
+                bool producer_wake = false;     // 주기가 바뀌어 마감 시각을 다시 잡아야 함
+                std::atomic<bool> producer_running{false};
             public:
-                Impl(SensorMode mode) : current_mode(mode), connected(false) {
-                    // 네트워크 클라이언트 생성
-                    network_client = std::make_unique<Network::NetworkClient>();
-                    
-                    // 센서 데이터 수신 콜백 설정
-                    network_client->setOnSensorDataReceived([this](const SensorData& data) {
-                        this->latest_sensor_data = data;
-                    });
+                Impl(SensorMode mode) : current_mode(mode) {
+                    auto mock = std::make_unique<MockSource>();
+                    mock_source = mock.get();
+                    sources.push_back({kMockSourceId, std::move(mock)});
 
-                    // 연결 상태 변경 콜백 설정
-                    network_client->setOnConnectionStateChanged([this](Network::ConnectionState state) {
-                        this->connected = (state == Network::ConnectionState::CONNECTED);
+                    auto pi = std::make_unique<Network::RaspberryPiSource>();
+                    pi_source = pi.get();
+                    // 연결 상태 변경은 버스로 발행
+                    pi_source->setOnConnectionStateChanged([this](Network::ConnectionState state) {
+                        this->publishConnectionState(pi_source->getDeviceId(), state);
                     });
+                    sources.push_back({kRaspberryPiSourceId, std::move(pi)});
 
-                    // 목 데이터 생성기 초기화
+                    selectMode(mode);
+                }
+                ~Impl() {
+                    stopProducer();
+                    // 버스가 매니저보다 오래 살아남는 경우 커서가 링을 막지 않도록 해제
+                    if (event_bus && command_subscriber != Event::EventBus::kInvalidSubscriber) {
+                        event_bus->unsubscribe(command_subscriber);
+                    }
+                }
+
+                /// @brief 모드 전환: 해당 내장 소스를 켜고 다른 내장 소스는 끔 (추가 소스는 그대로)
+                void selectMode(SensorMode mode) {
+                    current_mode = mode;
                     if (mode == SensorMode::MOCK_DATA) {
-                        setupMockDataGenerator();
-                    }
-                }                      
-                void setupMockDataGenerator() {
-                    // 목 데이터 생성기 설정
-                }
-                SensorData generateMockData() {
-                    SensorData data;                    
-                    data.temperature = static_cast<float>(temp_dist(gen));
-                    data.humidity = static_cast<float>(humidity_dist(gen));
-                    data.pressure = static_cast<float>(pressure_dist(gen));
-                    data.light = static_cast<float>(light_dist(gen));
-                    data.motion_detected = motion_dist(gen) == 1;
-                    data.cpu_usage = static_cast<float>(cpu_dist(gen));
-                    data.memory_usage = static_cast<float>(mem_dist(gen));
-                    data.data_valid = true;
-                    return data;
-                }
-                SensorData fetchRaspberryPiData() {
-                    // 네트워크에서 수신된 메시지 처리
-                    network_client->processIncomingMessages();
-                    
-                    // 최신 센서 데이터 반환
-                    return latest_sensor_data;
+                        // 다음 수집 시각부터 다시 샘플링 (모드 전환 사이의 공백은 생성하지 않음)
+                        pi_source->stop();
+                        mock_source->start();
+                    } else {
+                        mock_source->stop();
+                    }
+                }
+
+                /// @brief 최신 샘플을 제공하는 소스 (현재 모드의 내장 소스, 없으면 nullptr)
+                SensorSource* primarySource() const {
+                    switch (current_mode) {
+                    case SensorMode::MOCK_DATA:
+                        return mock_source;
+                    case SensorMode::RASPBERRY_PI:
+                        return pi_source;
+                    default:
+                        return nullptr;
+                    }
+                }
+
+                SourceEntry* findSource(SourceId id) {
+                    for (auto& entry : sources) {
+                        if (entry.id == id) {
+                            return &entry;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                /// @brief 수집 한 번: 명령 처리 후 실행 중인 소스마다 쌓인 샘플을 읽어 파이프라인 실행
+                void step() {
+                    processBusCommands();
+                    const Time::Timestamp t = now();
+                    const SensorSource* primary = primarySource();
+                    for (auto& entry : sources) {
+                        SensorSource& source = *entry.source;
+                        if (!source.isRunning()) {
+                            continue;
+                        }
+                        const bool is_primary = &source == primary;
+                        source.collect(t, ingest_batch, [this, is_primary, &source](SensorBatch&) {
+                            // 최신 샘플은 주 소스 자신의 디바이스 배치에서만 갱신
+                            flushIngest(is_primary && ingest_batch.device_id == source.getDeviceId());
+                        });
+                    }
+                }
+
+                /// @brief 수집 주기가 됐으면 한 번 수집 (밀린 주기는 몰아서 한 번만)
+                void updateIfDue() {
+                    const Time::Timestamp t = now();
+                    if (update_started && t < next_update) {
+                        return;
+                    }
+                    step();
+                    next_update = (update_started && t - next_update < update_interval) ? next_update + update_interval
+                                                                                         : t + update_interval;
+                    update_started = true;
+                }
+
+                /// @brief 현재 모드의 최신 샘플 (소스가 없거나 연결되지 않았으면 무효 데이터)
+                SensorData snapshot() const {
+                    const SensorSource* primary = primarySource();
+                    if (primary && primary->isRunning()) {
+                        return latest_sensor_data;
+                    }
+                    SensorData invalid_data;
+                    invalid_data.data_valid = false;
+                    return invalid_data;
+                }
+
+                void startProducer() {
+                    if (producer.joinable()) {
+                        return;
+                    }
+                    producer_stop = false;
+                    producer_running = true;
+                    producer = std::thread([this] { runProducer(); });
+                }
+
+                void stopProducer() {
+                    if (!producer.joinable()) {
+                        return;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(producer_mutex);
+                        producer_stop = true;
+                    }
+                    producer_cv.notify_all();
+                    producer.join();
+                    producer_running = false;
+                }
+
+                /// @brief 샘플링 스레드 본체: 정해진 시각마다 깨어나 수집 (주기 변경 시 즉시 깨움)
+                void runProducer() {
+                    auto deadline = std::chrono::steady_clock::now();
+                    while (true) {
+                        std::chrono::nanoseconds interval;
+                        {
+                            std::lock_guard<std::recursive_mutex> lock(pipeline_mutex);
+                            step();
+                            interval = std::chrono::nanoseconds(update_interval);
+                        }
+                        deadline += interval;
+                        const auto current = std::chrono::steady_clock::now();
+                        if (deadline < current) {
+                            deadline = current;    // 처리가 주기보다 오래 걸리면 따라잡지 않고 바로 다음 수집
+                        }
+                        std::unique_lock<std::mutex> lock(producer_mutex);
+                        producer_cv.wait_until(lock, deadline, [this] { return producer_stop || producer_wake; });
+                        if (producer_stop) {
+                            return;
+                        }
+                        if (producer_wake) {
+                            producer_wake = false;
+                            deadline = std::chrono::steady_clock::now();
+                        }
+                    }
+                }
+
+                Time::Timestamp now() const {
+                    return clock ? clock->now() : Time::defaultClock().now();
+                }
+
+                /// @param primary 현재 모드 소스의 배치면 최신 샘플 갱신
+                void flushIngest(bool primary) {
+                    if (ingest_batch.empty()) {
+                        return;
+                    }
+                    // 배치마다 한 번 표를 잡아두므로 교체 중에도 배치 하나는 같은 표로 보정된다
+                    if (auto table = currentCalibration()) {
+                        table->apply(ingest_batch);
+                    }
+                    validator.process(ingest_batch);
+                    if (primary) {
+                        latest_sensor_data = ingest_batch.sampleAt(ingest_batch.size() - 1);
+                    }
+                    filter_bank.process(ingest_batch);
+                    derived_channels.evaluate(ingest_batch);
+
+                    pending_alerts.clear();
+                    alert_engine.process(ingest_batch, pending_alerts);
+                    if (onAlert) {
+                        for (const auto& event : pending_alerts) {
+                            onAlert(event);
+                        }
+                    }
+                    for (const auto& entry : batch_processors) {
+                        entry.second(ingest_batch);
+                    }
+                    publishBatch();
+                    if (shared_ring) {
+                        if (shared_ring_channels != channel_registry.size()) {
+                            shared_ring->setChannelNames(channel_registry);
+                            shared_ring_channels = channel_registry.size();
+                        }
+                        shared_ring->write(ingest_batch);
+                    }
+                    ingest_batch.clear();
+                }
+
+                std::shared_ptr<const CalibrationTable> currentCalibration() const {
+                    std::lock_guard<std::mutex> lock(calibration_mutex);
+                    return calibration;
+                }
+
+                void publishBatch() {
+                    if (!event_bus) {
+                        return;
+                    }
+                    Event::BusEvent event;
+                    Event::SampleEvent sample;
+                    sample.device_id = ingest_batch.device_id;
+                    size_t extra = std::min(ingest_batch.channelCount() - kSensorChannelCount,
+                                            Event::SampleEvent::kMaxExtraChannels);
+                    sample.extra_count = static_cast<uint16_t>(extra);
+                    for (size_t i = 0; i < ingest_batch.size(); ++i) {
+                        sample.data = ingest_batch.sampleAt(i);
+                        for (size_t e = 0; e < extra; ++e) {
+                            sample.extra[e] = ingest_batch.columns[kSensorChannelCount + e][i];
+                        }
+                        event.timestamp_ns = ingest_batch.timestamps_ns[i];
+                        event.payload = sample;
+                        event_bus->publish(event);
+                    }
+                    for (const auto& alert : pending_alerts) {
+                        event.timestamp_ns = alert.timestamp_ns;
+                        event.payload = alert;
+                        event_bus->publish(event);
+                    }
+                }
+
+                void publishConnectionState(uint32_t device_id, Network::ConnectionState state) {
+                    if (!event_bus) {
+                        return;
+                    }
+                    Event::BusEvent event;
+                    event.timestamp_ns = now();
+                    event.payload = Event::ConnectionEvent{device_id, state};
+                    event_bus->publish(event);
+                }
+
+                /// @brief 버스로 들어온 명령 처리 (이 매니저 대상만)
+                void processBusCommands() {
+                    if (!event_bus || command_subscriber == Event::EventBus::kInvalidSubscriber) {
+                        return;
+                    }
+                    event_bus->poll(command_subscriber, [this](const Event::BusEvent& event) {
+                        const auto* cmd = std::get_if<Event::CommandEvent>(&event.payload);
+                        if (!cmd) {
+                            return;
+                        }
+                        // 같은 디바이스의 실행 중인 소스 중 처음 처리한 소스에서 멈춤
+                        for (auto& entry : sources) {
+                            SensorSource& source = *entry.source;
+                            if (source.getDeviceId() == cmd->device_id && source.isRunning() &&
+                                source.handleCommand(cmd->command, cmd->value)) {
+                                break;
+                            }
+                        }
+                    });
                 }
         };
 
@@ -122,65 +380,223 @@ namespace DachshundEngine {
 
         // SensorDataManager 연결 관리
         bool SensorDataManager::connectToRaspberryPi(const std::string& ip_address, int port) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
             if (pImpl->current_mode != SensorMode::RASPBERRY_PI) {
                 setMode(SensorMode::RASPBERRY_PI);
             }
 
-            pImpl->raspberry_pi_ip = ip_address;
-            pImpl->raspberry_pi_port = port;
-
-            // 네트워크 클라이언트로 연결 시도
-            bool success = pImpl->network_client->connect(ip_address, port);
-            pImpl->connected = success;
-            
-            return pImpl->connected;
+            // 라즈베리파이 소스로 연결 시도
+            pImpl->pi_source->setAddress(ip_address, port);
+            return pImpl->pi_source->start();
         }
 
         void SensorDataManager::disconnect() {
-            pImpl->network_client->disconnect();
-            pImpl->connected = false;
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            pImpl->pi_source->stop();
         }
 
         bool SensorDataManager::isConnected() const {
-            return pImpl->connected;
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            return pImpl->pi_source->isRunning();
         }
 
         // SensorDataManager 데이터 수신
         SensorData SensorDataManager::getCurrentSensorData() {
-            switch (pImpl->current_mode)
-            {
-            case SensorMode::MOCK_DATA:
-                return pImpl->generateMockData();
-                break;
-            case SensorMode::RASPBERRY_PI:
-                if(pImpl->connected) {
-                    return pImpl->fetchRaspberryPiData();
-                }
-                break;
-            case SensorMode::FILE_REPLAY:
-                break;
-            default:
-                break;
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            // 샘플링 스레드가 없으면 호출하는 쪽이 주기를 대신 구동 (주기 전이면 수집 없이 최신 값만 반환)
+            if (!pImpl->producer_running) {
+                pImpl->updateIfDue();
             }
-
             // 연결되지 않았거나 오류 시 빈 데이터 반환
-            SensorData invalid_data;
-            invalid_data.data_valid = false;
-            return invalid_data;
+            return pImpl->snapshot();
         }
         void SensorDataManager::setMode(SensorMode mode) {
-            pImpl->current_mode = mode;
-            if (mode == SensorMode::MOCK_DATA) {
-                pImpl->setupMockDataGenerator();
-            }
-            // TODO: 다른 모드 전환 시 필요한 초기화 작업 추가 가능
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            pImpl->selectMode(mode);
         }
         SensorMode SensorDataManager::getMode() const {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
             return pImpl->current_mode;
         }
 
         void SensorDataManager::setUpdateInterval(float milliseconds) {
-            // TODO: 데이터 송수신 인터벌 설정
+            if (!(milliseconds > 0.0f)) {
+                return;
+            }
+            {
+                std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+                pImpl->update_interval = std::max<Time::Timestamp>(Time::fromMilliseconds(milliseconds), 1);
+                pImpl->update_started = false;
+                // 목 소스가 한 번에 따라잡는 구간: 1초 또는 두 수집 주기
+                pImpl->mock_source->setMaxBacklog(std::max(Time::kNanosPerSecond, 2 * pImpl->update_interval));
+            }
+            // 긴 주기로 자고 있던 샘플링 스레드를 깨워 새 주기로 다시 잡게 함
+            {
+                std::lock_guard<std::mutex> lock(pImpl->producer_mutex);
+                pImpl->producer_wake = true;
+            }
+            pImpl->producer_cv.notify_all();
+        }
+
+        float SensorDataManager::getUpdateInterval() const {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            return static_cast<float>(Time::toMilliseconds(pImpl->update_interval));
+        }
+
+        void SensorDataManager::startSampling() {
+            pImpl->startProducer();
+        }
+
+        void SensorDataManager::stopSampling() {
+            pImpl->stopProducer();
+        }
+
+        bool SensorDataManager::isSampling() const {
+            return pImpl->producer_running;
+        }
+
+        std::unique_lock<std::recursive_mutex> SensorDataManager::lockPipeline() {
+            return std::unique_lock<std::recursive_mutex>(pImpl->pipeline_mutex);
+        }
+
+        void SensorDataManager::setCalibration(std::shared_ptr<const CalibrationTable> table) {
+            // 이전 표는 잠금 밖에서 해제 (수집 스레드가 아직 쥐고 있으면 그쪽에서 해제됨)
+            {
+                std::lock_guard<std::mutex> lock(pImpl->calibration_mutex);
+                pImpl->calibration.swap(table);
+            }
+        }
+
+        std::shared_ptr<const CalibrationTable> SensorDataManager::getCalibration() const {
+            return pImpl->currentCalibration();
+        }
+
+        ChannelRegistry& SensorDataManager::getChannelRegistry() {
+            return pImpl->channel_registry;
+        }
+
+        MockGenerator& SensorDataManager::getMockGenerator() {
+            return pImpl->mock_source->getGenerator();
+        }
+
+        SourceId SensorDataManager::addSource(std::unique_ptr<SensorSource> source, bool start) {
+            if (!source) {
+                return kInvalidSourceId;
+            }
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            if (start && !source->isRunning() && !source->start()) {
+                pImpl->last_source_error = source->getLastError();
+                if (pImpl->last_source_error.empty()) {
+                    pImpl->last_source_error = std::string("cannot start ") + source->getType() + " source";
+                }
+                return kInvalidSourceId;
+            }
+            pImpl->last_source_error.clear();
+            for (const auto& rule : source->getValidationRules()) {
+                pImpl->validator.setDeviceRule(source->getDeviceId(), rule);
+            }
+            SourceId id = pImpl->next_source_id++;
+            pImpl->sources.push_back({id, std::move(source)});
+            return id;
+        }
+
+        bool SensorDataManager::removeSource(SourceId id) {
+            if (id == kMockSourceId || id == kRaspberryPiSourceId) {
+                return false;
+            }
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            auto& sources = pImpl->sources;
+            auto it = std::find_if(sources.begin(), sources.end(), [id](const auto& entry) { return entry.id == id; });
+            if (it == sources.end()) {
+                return false;
+            }
+            it->source->stop();
+            for (const auto& rule : it->source->getValidationRules()) {
+                pImpl->validator.removeDeviceRule(it->source->getDeviceId(), rule.channel);
+            }
+            sources.erase(it);
+            return true;
+        }
+
+        SensorSource* SensorDataManager::getSource(SourceId id) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            auto* entry = pImpl->findSource(id);
+            return entry ? entry->source.get() : nullptr;
+        }
+
+        std::vector<SourceId> SensorDataManager::getSourceIds() const {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            std::vector<SourceId> ids;
+            for (const auto& entry : pImpl->sources) {
+                ids.push_back(entry.id);
+            }
+            return ids;
+        }
+
+        std::string SensorDataManager::getLastSourceError() const {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            return pImpl->last_source_error;
+        }
+
+        DataValidator& SensorDataManager::getValidator() {
+            return pImpl->validator;
+        }
+
+        FilterBank& SensorDataManager::getFilterBank() {
+            return pImpl->filter_bank;
+        }
+
+        DerivedChannelSet& SensorDataManager::getDerivedChannels() {
+            return pImpl->derived_channels;
+        }
+
+        Alert::AlertEngine& SensorDataManager::getAlertEngine() {
+            return pImpl->alert_engine;
+        }
+
+        void SensorDataManager::setOnAlert(std::function<void(const Alert::AlertEvent&)> callback) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            pImpl->onAlert = callback;
+        }
+
+        size_t SensorDataManager::addBatchProcessor(BatchProcessor processor) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            size_t id = pImpl->next_processor_id++;
+            pImpl->batch_processors.emplace_back(id, std::move(processor));
+            return id;
+        }
+
+        void SensorDataManager::removeBatchProcessor(size_t id) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            auto& processors = pImpl->batch_processors;
+            processors.erase(std::remove_if(processors.begin(), processors.end(),
+                                            [id](const auto& entry) { return entry.first == id; }),
+                             processors.end());
+        }
+
+        void SensorDataManager::setClock(std::shared_ptr<Time::Clock> clock) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            pImpl->clock = std::move(clock);
+        }
+
+        Time::Clock& SensorDataManager::getClock() const {
+            return pImpl->clock ? *pImpl->clock : Time::defaultClock();
+        }
+
+        void SensorDataManager::attachEventBus(Event::EventBus* bus) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            if (pImpl->event_bus && pImpl->command_subscriber != Event::EventBus::kInvalidSubscriber) {
+                pImpl->event_bus->unsubscribe(pImpl->command_subscriber);
+            }
+            pImpl->event_bus = bus;
+            pImpl->command_subscriber = bus ? bus->subscribe("sensor_manager")
+                                            : Event::EventBus::kInvalidSubscriber;
+        }
+
+        void SensorDataManager::attachSharedRing(Ipc::SharedRingWriter* ring) {
+            std::lock_guard<std::recursive_mutex> lock(pImpl->pipeline_mutex);
+            pImpl->shared_ring = ring;
+            pImpl->shared_ring_channels = 0;
         }
     }
-}
\ No newline at end of file
+}
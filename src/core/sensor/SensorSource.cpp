@@ -0,0 +1,140 @@
+#include "core/sensor/SensorSource.h"
+#include "core/sensor/MockGenerator.h"
+#include "core/sensor/HostSource.h"
+#include "core/sensor/SerialSource.h"
+#include "core/sensor/MqttSource.h"
+#include "core/network/RaspberryPiSource.h"
+#include <algorithm>
+#include <mutex>
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        /// @brief SourceRegistry 구현 클래스 (Pimpl 패턴)
+        class SourceRegistry::Impl {
+        public:
+            std::vector<std::pair<std::string, SourceFactory>> factories;
+            mutable std::mutex mutex;
+        };
+
+        /// @brief SourceRegistry 메서드 구현
+        SourceRegistry::SourceRegistry() : pImpl(std::make_unique<Impl>()) {}
+        SourceRegistry::~SourceRegistry() = default;
+
+        bool SourceRegistry::registerType(const std::string& type, SourceFactory factory) {
+            if (type.empty() || !factory) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            for (const auto& entry : pImpl->factories) {
+                if (entry.first == type) {
+                    return false;
+                }
+            }
+            pImpl->factories.emplace_back(type, std::move(factory));
+            return true;
+        }
+
+        std::unique_ptr<SensorSource> SourceRegistry::create(const std::string& type) const {
+            SourceFactory factory;
+            {
+                std::lock_guard<std::mutex> lock(pImpl->mutex);
+                for (const auto& entry : pImpl->factories) {
+                    if (entry.first == type) {
+                        factory = entry.second;
+                        break;
+                    }
+                }
+            }
+            return factory ? factory() : nullptr;
+        }
+
+        std::vector<std::string> SourceRegistry::getTypes() const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            std::vector<std::string> types;
+            for (const auto& entry : pImpl->factories) {
+                types.push_back(entry.first);
+            }
+            return types;
+        }
+
+        SourceRegistry& sourceRegistry() {
+            static SourceRegistry registry;
+            static const bool builtins = [] {
+                registry.registerType("mock", [] { return std::make_unique<MockSource>(); });
+                registry.registerType("raspberry_pi", [] { return std::make_unique<Network::RaspberryPiSource>(); });
+                registry.registerType("host", [] { return std::make_unique<HostSource>(); });
+                registry.registerType("serial", [] { return std::make_unique<SerialSource>(); });
+                registry.registerType("mqtt", [] { return std::make_unique<MqttSource>(); });
+                return true;
+            }();
+            (void)builtins;
+            return registry;
+        }
+
+        /// @brief MockSource 구현 클래스 (Pimpl 패턴)
+        class MockSource::Impl {
+        public:
+            MockGenerator generator;
+            Time::Timestamp next_sample = 0;
+            Time::Timestamp max_backlog = Time::kNanosPerSecond;
+            bool running = false;
+            bool started = false;     // 첫 read()에서 시각을 잡음 (정지 구간은 생성하지 않음)
+        };
+
+        /// @brief MockSource 메서드 구현
+        MockSource::MockSource() : pImpl(std::make_unique<Impl>()) {}
+        MockSource::~MockSource() = default;
+
+        const char* MockSource::getType() const {
+            return "mock";
+        }
+
+        bool MockSource::start() {
+            pImpl->running = true;
+            pImpl->started = false;
+            return true;
+        }
+
+        void MockSource::stop() {
+            pImpl->running = false;
+        }
+
+        bool MockSource::isRunning() const {
+            return pImpl->running;
+        }
+
+        size_t MockSource::read(SensorBatch& out, Time::Timestamp now) {
+            Impl& impl = *pImpl;
+            if (!impl.running) {
+                return 0;
+            }
+            const Time::Timestamp interval = impl.generator.getInterval();
+            if (!impl.started) {
+                impl.next_sample = now;
+                impl.started = true;
+            }
+            if (now < impl.next_sample) {
+                return 0;
+            }
+            const Time::Timestamp max_samples = std::max<Time::Timestamp>(impl.max_backlog / interval, 1);
+            Time::Timestamp due = (now - impl.next_sample) / interval + 1;
+            if (due > max_samples) {
+                impl.next_sample += (due - max_samples) * interval;
+                due = max_samples;
+            }
+            impl.generator.generate(out, device_id, impl.next_sample, static_cast<size_t>(due));
+            impl.next_sample += due * interval;
+            return static_cast<size_t>(due);
+        }
+
+        MockGenerator& MockSource::getGenerator() {
+            return pImpl->generator;
+        }
+
+        void MockSource::setMaxBacklog(Time::Timestamp backlog_ns) {
+            pImpl->max_backlog = std::max<Time::Timestamp>(backlog_ns, 1);
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
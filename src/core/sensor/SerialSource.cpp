@@ -0,0 +1,438 @@
+#include "core/sensor/SerialSource.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            /// @brief read() 한 번에 읽을 최대 바이트 (수집 주기 한 번의 지연 상한)
+            constexpr size_t kMaxBytesPerRead = 64 * 1024;
+
+            /// @brief CRC-8 (다항식 0x07, 초기값 0) 테이블
+            const std::array<uint8_t, 256>& crcTable() {
+                static const std::array<uint8_t, 256> table = [] {
+                    std::array<uint8_t, 256> t{};
+                    for (int i = 0; i < 256; ++i) {
+                        uint8_t crc = static_cast<uint8_t>(i);
+                        for (int bit = 0; bit < 8; ++bit) {
+                            crc = static_cast<uint8_t>((crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1);
+                        }
+                        t[i] = crc;
+                    }
+                    return t;
+                }();
+                return table;
+            }
+
+            uint8_t crc8(const uint8_t* data, size_t size) {
+                const auto& table = crcTable();
+                uint8_t crc = 0;
+                for (size_t i = 0; i < size; ++i) {
+                    crc = table[crc ^ data[i]];
+                }
+                return crc;
+            }
+
+            float readFloatLE(const uint8_t* p) {
+                uint32_t bits;
+                std::memcpy(&bits, p, 4);
+                if constexpr (std::endian::native == std::endian::big) {
+                    bits = (bits >> 24) | ((bits >> 8) & 0xFF00) | ((bits << 8) & 0xFF0000) | (bits << 24);
+                }
+                float value;
+                std::memcpy(&value, &bits, 4);
+                return value;
+            }
+
+#ifndef _WIN32
+            speed_t toSpeed(int baud) {
+                switch (baud) {
+                case 9600:   return B9600;
+                case 19200:  return B19200;
+                case 38400:  return B38400;
+                case 57600:  return B57600;
+                case 115200: return B115200;
+                case 230400: return B230400;
+#ifdef B460800
+                case 460800: return B460800;
+#endif
+#ifdef B921600
+                case 921600: return B921600;
+#endif
+                default:     return 0;
+                }
+            }
+#endif
+        }
+
+        /// @brief SerialDecoder 구현 클래스 (Pimpl 패턴)
+        class SerialDecoder::Impl {
+        public:
+            SerialFramingConfig config;
+            SerialCounters counters;
+            std::vector<float> values;          // [frame][field]
+            std::string line;                   // LINE: 미완성 줄
+            bool discarding = false;            // LINE: 너무 긴 줄의 나머지를 버리는 중
+            std::vector<uint8_t> pending;       // BINARY: 미완성 프레임
+
+            explicit Impl(const SerialFramingConfig& cfg) : config(cfg) {}
+
+            size_t fieldCount() const { return config.fields.size(); }
+
+            /// @brief 완성된 한 줄 해석
+            void parseLine() {
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                const char* p = line.c_str();
+                while (*p == ' ' || *p == '\t') {
+                    ++p;
+                }
+                if (*p == '\0' || *p == '#') {
+                    return;
+                }
+                const size_t first = values.size();
+                values.resize(first + fieldCount(), std::nanf(""));
+                size_t field = 0;
+                while (*p != '\0') {
+                    char* end;
+                    const float value = std::strtof(p, &end);
+                    if (end == p) {
+                        values.resize(first);   // 숫자가 아닌 필드
+                        counters.bad_frames++;
+                        return;
+                    }
+                    if (field < fieldCount()) {
+                        values[first + field] = value;
+                    }
+                    ++field;
+                    p = end;
+                    while (*p == ' ' || *p == '\t' || *p == config.delimiter) {
+                        ++p;
+                    }
+                }
+                counters.frames++;
+            }
+
+            void feedLines(const uint8_t* data, size_t size) {
+                const char* p = reinterpret_cast<const char*>(data);
+                const char* end = p + size;
+                while (p < end) {
+                    const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+                    const char* chunk_end = newline ? newline : end;
+                    if (!discarding) {
+                        line.append(p, chunk_end);
+                        if (line.size() > config.max_frame_bytes) {
+                            line.clear();
+                            discarding = true;
+                            counters.bad_frames++;
+                        }
+                    }
+                    if (!newline) {
+                        return;
+                    }
+                    if (!discarding) {
+                        parseLine();
+                    }
+                    line.clear();
+                    discarding = false;
+                    p = newline + 1;
+                }
+            }
+
+            void feedBinary(const uint8_t* data, size_t size) {
+                pending.insert(pending.end(), data, data + size);
+                const uint8_t* buffer = pending.data();
+                const size_t available = pending.size();
+                size_t pos = 0;
+                while (pos + 3 <= available) {
+                    if (buffer[pos] != config.sync[0] || buffer[pos + 1] != config.sync[1]) {
+                        ++pos;
+                        continue;
+                    }
+                    const size_t count = buffer[pos + 2];
+                    const size_t frame_bytes = 3 + 4 * count + 1;
+                    if (frame_bytes > config.max_frame_bytes) {
+                        counters.bad_frames++;
+                        ++pos;
+                        continue;
+                    }
+                    if (pos + frame_bytes > available) {
+                        break;      // 나머지가 아직 안 옴
+                    }
+                    if (crc8(buffer + pos + 2, 1 + 4 * count) != buffer[pos + frame_bytes - 1]) {
+                        counters.bad_frames++;
+                        ++pos;      // 페이로드 안에 진짜 sync가 있을 수 있으므로 한 바이트만 건너뜀
+                        continue;
+                    }
+                    const size_t first = values.size();
+                    values.resize(first + fieldCount(), std::nanf(""));
+                    const uint8_t* payload = buffer + pos + 3;
+                    for (size_t f = 0; f < std::min(count, fieldCount()); ++f) {
+                        values[first + f] = readFloatLE(payload + 4 * f);
+                    }
+                    counters.frames++;
+                    pos += frame_bytes;
+                }
+                // 소비한 바이트만 버림 (남는 것은 미완성 프레임이거나 헤더 길이도 안 되는 꼬리)
+                pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(pos));
+            }
+        };
+
+        /// @brief SerialDecoder 메서드 구현
+        SerialDecoder::SerialDecoder(const SerialFramingConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        SerialDecoder::~SerialDecoder() = default;
+        SerialDecoder::SerialDecoder(SerialDecoder&&) noexcept = default;
+        SerialDecoder& SerialDecoder::operator=(SerialDecoder&&) noexcept = default;
+
+        void SerialDecoder::feed(const uint8_t* data, size_t size) {
+            if (size == 0) {
+                return;
+            }
+            pImpl->counters.bytes += size;
+            if (pImpl->config.framing == SerialFraming::LINE) {
+                pImpl->feedLines(data, size);
+            } else {
+                pImpl->feedBinary(data, size);
+            }
+        }
+
+        size_t SerialDecoder::frameCount() const {
+            const size_t fields = pImpl->fieldCount();
+            return fields > 0 ? pImpl->values.size() / fields : 0;
+        }
+
+        const std::vector<float>& SerialDecoder::values() const {
+            return pImpl->values;
+        }
+
+        size_t SerialDecoder::drain(SensorBatch& out, Time::Timestamp from_ns, Time::Timestamp to_ns) {
+            const size_t count = frameCount();
+            if (count == 0) {
+                pImpl->values.clear();
+                return 0;
+            }
+            const auto& fields = pImpl->config.fields;
+            const size_t field_count = fields.size();
+            size_t channels = kSensorChannelCount;
+            for (ChannelId channel : fields) {
+                channels = std::max<size_t>(channels, static_cast<size_t>(channel) + 1);
+            }
+            out.ensureChannels(channels);
+
+            const size_t first = out.size();
+            const Time::Timestamp span = std::max<Time::Timestamp>(to_ns - from_ns, static_cast<Time::Timestamp>(count));
+            out.timestamps_ns.reserve(first + count);
+            for (size_t i = 0; i < count; ++i) {
+                out.timestamps_ns.push_back(to_ns - span + span * static_cast<Time::Timestamp>(i + 1) / static_cast<Time::Timestamp>(count));
+            }
+            for (auto& column : out.columns) {
+                column.resize(first + count, std::nanf(""));
+            }
+            out.quality.resize(first + count, 0);
+            const float* values = pImpl->values.data();
+            for (size_t f = 0; f < field_count; ++f) {
+                float* column = out.columns[fields[f]].data() + first;
+                for (size_t i = 0; i < count; ++i) {
+                    column[i] = values[i * field_count + f];
+                }
+            }
+            pImpl->values.clear();
+            return count;
+        }
+
+        void SerialDecoder::reset() {
+            pImpl->values.clear();
+            pImpl->line.clear();
+            pImpl->discarding = false;
+            pImpl->pending.clear();
+        }
+
+        const SerialFramingConfig& SerialDecoder::getConfig() const {
+            return pImpl->config;
+        }
+
+        SerialCounters SerialDecoder::getCounters() const {
+            return pImpl->counters;
+        }
+
+        /// @brief SerialSource 구현 클래스 (Pimpl 패턴)
+        class SerialSource::Impl {
+        public:
+            SerialSourceConfig config;
+            SerialDecoder decoder;
+            int fd = -1;
+            Time::Timestamp last_read = 0;
+            bool started = false;
+            std::string last_error;
+            std::vector<uint8_t> buffer = std::vector<uint8_t>(4096);
+
+            explicit Impl(const SerialSourceConfig& cfg) : config(cfg), decoder(cfg.framing) {}
+
+            ~Impl() {
+                closePort();
+            }
+
+            bool openPort() {
+#ifndef _WIN32
+                const speed_t speed = toSpeed(config.baud);
+                if (speed == 0) {
+                    last_error = "unsupported baud rate " + std::to_string(config.baud);
+                    return false;
+                }
+                fd = ::open(config.device.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+                if (fd < 0) {
+                    last_error = "cannot open " + config.device + ": " + std::strerror(errno);
+                    return false;
+                }
+                // raw 8N1, 흐름 제어 없음, 읽기는 논블로킹 (VMIN=0, VTIME=0)
+                termios tty{};
+                if (tcgetattr(fd, &tty) != 0) {
+                    last_error = config.device + " is not a terminal";
+                    closePort();
+                    return false;
+                }
+                cfmakeraw(&tty);
+                tty.c_cflag |= CLOCAL | CREAD;
+                tty.c_cflag &= ~(CSTOPB | PARENB);
+#ifdef CRTSCTS
+                tty.c_cflag &= ~CRTSCTS;
+#endif
+                tty.c_cc[VMIN] = 0;
+                tty.c_cc[VTIME] = 0;
+                cfsetispeed(&tty, speed);
+                cfsetospeed(&tty, speed);
+                if (tcsetattr(fd, TCSANOW, &tty) != 0) {
+                    last_error = "cannot configure " + config.device + ": " + std::strerror(errno);
+                    closePort();
+                    return false;
+                }
+                tcflush(fd, TCIFLUSH);     // 열기 전에 쌓인 반쪽 프레임 버림
+                last_error.clear();
+                return true;
+#else
+                last_error = "serial source is not available on this platform";
+                return false;
+#endif
+            }
+
+            void closePort() {
+#ifndef _WIN32
+                if (fd >= 0) {
+                    ::close(fd);
+                }
+#endif
+                fd = -1;
+            }
+        };
+
+        /// @brief SerialSource 메서드 구현
+        SerialSource::SerialSource(const SerialSourceConfig& config) : pImpl(std::make_unique<Impl>(config)) {}
+        SerialSource::~SerialSource() = default;
+
+        const char* SerialSource::getType() const {
+            return "serial";
+        }
+
+        bool SerialSource::start() {
+            Impl& impl = *pImpl;
+            if (impl.fd >= 0) {
+                return true;
+            }
+            impl.decoder = SerialDecoder(impl.config.framing);
+            impl.started = false;
+            return impl.openPort();
+        }
+
+        void SerialSource::stop() {
+            pImpl->closePort();
+        }
+
+        bool SerialSource::isRunning() const {
+            return pImpl->fd >= 0;
+        }
+
+        size_t SerialSource::read(SensorBatch& out, Time::Timestamp now) {
+            Impl& impl = *pImpl;
+            if (impl.fd < 0) {
+                return 0;
+            }
+#ifndef _WIN32
+            // raw 모드 read()는 반대편이 끊겨도 0만 돌려줄 수 있으므로 끊김은 poll로 확인
+            pollfd pfd{impl.fd, POLLIN, 0};
+            const bool hangup = ::poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLHUP | POLLERR | POLLNVAL)) != 0;
+            size_t total = 0;
+            while (total < kMaxBytesPerRead) {
+                const ssize_t n = ::read(impl.fd, impl.buffer.data(), impl.buffer.size());
+                if (n > 0) {
+                    impl.decoder.feed(impl.buffer.data(), static_cast<size_t>(n));
+                    total += static_cast<size_t>(n);
+                    continue;
+                }
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                // VMIN=0 raw 모드에서는 읽을 것이 없으면 0 또는 EAGAIN
+                if (n == 0 || errno == EAGAIN || errno == EWOULDBLOCK) {
+                    break;
+                }
+                // EIO 등: 장치 분리 또는 의사 터미널 반대편이 닫힘
+                impl.last_error = impl.config.device + ": " + std::strerror(errno);
+                impl.closePort();
+                break;
+            }
+            if (hangup && impl.fd >= 0) {
+                impl.last_error = impl.config.device + ": hangup";
+                impl.closePort();
+            }
+#endif
+            // 이번 주기에 도착한 프레임은 지난 읽기 이후 구간에 고르게 배치
+            const size_t frames = impl.decoder.frameCount();
+            const Time::Timestamp from = impl.started ? impl.last_read
+                                                      : now - static_cast<Time::Timestamp>(frames) * Time::kNanosPerMilli;
+            impl.last_read = now;
+            impl.started = true;
+            out.device_id = device_id;
+            return impl.decoder.drain(out, from, now);
+        }
+
+        std::string SerialSource::getStatus() const {
+            if (pImpl->fd < 0) {
+                return pImpl->last_error.empty() ? "closed" : pImpl->last_error;
+            }
+            const SerialCounters counters = pImpl->decoder.getCounters();
+            return pImpl->config.device + " " + std::to_string(counters.frames) + " frames, " +
+                   std::to_string(counters.bad_frames) + " bad";
+        }
+
+        void SerialSource::setConfig(const SerialSourceConfig& config) {
+            pImpl->config = config;
+        }
+
+        const SerialSourceConfig& SerialSource::getConfig() const {
+            return pImpl->config;
+        }
+
+        SerialCounters SerialSource::getCounters() const {
+            return pImpl->decoder.getCounters();
+        }
+
+        std::string SerialSource::getLastError() const {
+            return pImpl->last_error;
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
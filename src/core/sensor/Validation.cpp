@@ -0,0 +1,182 @@
+#include "core/sensor/Validation.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace DachshundEngine {
+    namespace Sensor {
+
+        namespace {
+            uint64_t streamKey(uint32_t device_id, ChannelId channel) {
+                return (static_cast<uint64_t>(device_id) << 16) | channel;
+            }
+        }
+
+        std::vector<ValidationRule> defaultValidationRules() {
+            const Time::Timestamp ten_minutes = 600 * Time::kNanosPerSecond;
+            return {
+                { toChannelId(SensorChannel::TEMPERATURE), -40.0f, 85.0f, ten_minutes, true },
+                { toChannelId(SensorChannel::HUMIDITY), 0.0f, 100.0f, ten_minutes, true },
+                { toChannelId(SensorChannel::PRESSURE), 300.0f, 1100.0f, ten_minutes, true },
+                { toChannelId(SensorChannel::LIGHT), 0.0f, 100000.0f, 0, true },
+                { toChannelId(SensorChannel::MOTION), 0.0f, 1.0f, 0, true },
+                { toChannelId(SensorChannel::CPU_USAGE), 0.0f, 100.0f, 0, true },
+                { toChannelId(SensorChannel::MEMORY_USAGE), 0.0f, 100.0f, 0, true }
+            };
+        }
+
+        /// @brief DataValidator 구현 클래스 (Pimpl 패턴)
+        class DataValidator::Impl {
+        public:
+            /// @brief 고착 판정용 디바이스/채널 상태
+            struct StuckState {
+                float last_value = std::nanf("");
+                Time::Timestamp last_change = 0;
+            };
+
+            std::vector<ValidationRule> rules;
+            std::vector<QualityCounters> counters;      // rules와 같은 인덱스
+            std::unordered_map<uint64_t, StuckState> stuck_states;
+            std::unordered_map<uint64_t, ValidationRule> device_rules;  // streamKey -> 디바이스 규칙
+            mutable std::mutex mutex;
+
+            size_t indexOf(ChannelId channel) const {
+                for (size_t i = 0; i < rules.size(); ++i) {
+                    if (rules[i].channel == channel) {
+                        return i;
+                    }
+                }
+                return rules.size();
+            }
+
+            /// @brief 열 하나 검증 (샘플 루프 안에 분기 없음)
+            void check(const ValidationRule& rule, QualityCounters& total, StuckState& stuck,
+                       std::vector<float>& column, const std::vector<Time::Timestamp>& timestamps,
+                       std::vector<uint32_t>& quality) {
+                const size_t n = column.size();
+                float* x = column.data();
+                const Time::Timestamp* t = timestamps.data();
+                uint32_t* q = quality.data();
+                const uint32_t bit = rule.channel < 32 ? (1u << rule.channel) : 0u;
+                const bool check_stuck = rule.stuck_ns > 0;
+                const float nan = std::nanf("");
+
+                float last_value = stuck.last_value;
+                Time::Timestamp last_change = stuck.last_change;
+                uint64_t nan_count = 0, range_count = 0, stuck_count = 0, bad_count = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    const float v = x[i];
+                    const bool is_nan = std::isnan(v);
+                    const bool out_of_range = !is_nan & !((v >= rule.min) & (v <= rule.max));
+                    // NaN은 변화로 치지 않음. 첫 샘플은 last_value가 NaN이라 항상 변화
+                    const bool changed = !is_nan & (v != last_value);
+                    last_change = changed ? t[i] : last_change;
+                    last_value = is_nan ? last_value : v;
+                    const bool is_stuck = check_stuck & !is_nan & (t[i] - last_change >= rule.stuck_ns);
+                    const bool bad = is_nan | out_of_range | is_stuck;
+
+                    q[i] |= bit & (0u - static_cast<uint32_t>(bad));
+                    x[i] = (rule.drop_out_of_range & out_of_range) ? nan : v;
+                    nan_count += is_nan;
+                    range_count += out_of_range;
+                    stuck_count += is_stuck;
+                    bad_count += bad;
+                }
+                stuck.last_value = last_value;
+                stuck.last_change = last_change;
+
+                total.samples += n;
+                total.nan += nan_count;
+                total.out_of_range += range_count;
+                total.stuck += stuck_count;
+                total.bad += bad_count;
+            }
+        };
+
+        /// @brief DataValidator 메서드 구현
+        DataValidator::DataValidator(const std::vector<ValidationRule>& rules) : pImpl(std::make_unique<Impl>()) {
+            for (const auto& rule : rules) {
+                setRule(rule);
+            }
+        }
+        DataValidator::~DataValidator() = default;
+        DataValidator::DataValidator(DataValidator&&) noexcept = default;
+        DataValidator& DataValidator::operator=(DataValidator&&) noexcept = default;
+
+        void DataValidator::setRule(const ValidationRule& rule) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            size_t index = pImpl->indexOf(rule.channel);
+            if (index == pImpl->rules.size()) {
+                pImpl->rules.push_back(rule);
+                pImpl->counters.emplace_back();
+            } else {
+                pImpl->rules[index] = rule;
+            }
+        }
+
+        bool DataValidator::removeRule(ChannelId channel) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            size_t index = pImpl->indexOf(channel);
+            if (index == pImpl->rules.size()) {
+                return false;
+            }
+            pImpl->rules.erase(pImpl->rules.begin() + static_cast<std::ptrdiff_t>(index));
+            pImpl->counters.erase(pImpl->counters.begin() + static_cast<std::ptrdiff_t>(index));
+            // 같은 채널 규칙을 다시 넣으면 고착 시간이 처음부터 다시 쌓이도록 상태도 지움
+            std::erase_if(pImpl->stuck_states, [channel](const auto& entry) {
+                return static_cast<ChannelId>(entry.first & 0xFFFF) == channel;
+            });
+            return true;
+        }
+
+        std::vector<ValidationRule> DataValidator::getRules() const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return pImpl->rules;
+        }
+
+        void DataValidator::setDeviceRule(uint32_t device_id, const ValidationRule& rule) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->device_rules[streamKey(device_id, rule.channel)] = rule;
+        }
+
+        bool DataValidator::removeDeviceRule(uint32_t device_id, ChannelId channel) {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            return pImpl->device_rules.erase(streamKey(device_id, channel)) > 0;
+        }
+
+        void DataValidator::process(SensorBatch& batch) {
+            if (batch.empty()) {
+                return;
+            }
+            batch.quality.resize(batch.size(), 0);
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            for (size_t r = 0; r < pImpl->rules.size(); ++r) {
+                const uint64_t key = streamKey(batch.device_id, pImpl->rules[r].channel);
+                const ValidationRule* rule_ptr = &pImpl->rules[r];
+                if (!pImpl->device_rules.empty()) {
+                    auto it = pImpl->device_rules.find(key);
+                    rule_ptr = it != pImpl->device_rules.end() ? &it->second : rule_ptr;
+                }
+                const ValidationRule& rule = *rule_ptr;
+                if (rule.channel >= batch.channelCount()) {
+                    continue;
+                }
+                Impl::StuckState& stuck = pImpl->stuck_states[key];
+                pImpl->check(rule, pImpl->counters[r], stuck, batch.columns[rule.channel], batch.timestamps_ns, batch.quality);
+            }
+        }
+
+        QualityCounters DataValidator::getCounters(ChannelId channel) const {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            size_t index = pImpl->indexOf(channel);
+            return index < pImpl->counters.size() ? pImpl->counters[index] : QualityCounters();
+        }
+
+        void DataValidator::resetCounters() {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            std::fill(pImpl->counters.begin(), pImpl->counters.end(), QualityCounters());
+        }
+
+    } // namespace Sensor
+} // namespace DachshundEngine
@@ -0,0 +1,32 @@
+#include "core/time/Clock.h"
+#include <chrono>
+
+namespace DachshundEngine {
+    namespace Time {
+
+        Timestamp SteadyClock::now() const {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void VirtualClock::advance(Timestamp delta) {
+            if (delta > 0) {
+                current.fetch_add(delta, std::memory_order_acq_rel);
+            }
+        }
+
+        void VirtualClock::set(Timestamp time) {
+            Timestamp prev = current.load(std::memory_order_relaxed);
+            while (time > prev &&
+                   !current.compare_exchange_weak(prev, time, std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed)) {
+            }
+        }
+
+        Clock& defaultClock() {
+            static SteadyClock clock;
+            return clock;
+        }
+
+    } // namespace Time
+} // namespace DachshundEngine
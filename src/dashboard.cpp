@@ -5,11 +5,39 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 #include <implot.h>
+#include <algorithm>
 #include <cmath>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 // 분리된 센서 타입 포함
 #include "core/sensor/SensorManager.h"
+#include "core/sensor/SensorBatch.h"
+#include "core/sensor/DerivedChannels.h"
+#include "core/sensor/Calibration.h"
+#include "core/sensor/FilterBank.h"
+#include "core/sensor/Validation.h"
+#include "core/sensor/MockGenerator.h"
+#include "core/sensor/SensorSource.h"
+#include "core/sensor/SerialSource.h"
+#include "core/sensor/MqttSource.h"
+#include "core/alert/AlertEngine.h"
+#include "core/event/EventBus.h"
+#include "core/ipc/SharedRing.h"
+#include "core/time/Clock.h"
+#include "core/analytics/SpectralAnalyzer.h"
+#include "core/analytics/AnomalyDetector.h"
+#include "core/analytics/QuantileSketch.h"
+#include "core/analytics/FleetAggregator.h"
+#include "core/analytics/CorrelationMatrix.h"
+#include "core/analytics/Resampler.h"
+#include "core/analytics/TimeAlignedJoin.h"
+#include "core/analytics/HistogramStore.h"
+#include "core/analytics/EdgeLog.h"
+#include "core/analytics/TriggerCapture.h"
 
 // Define ImGui docking flags if not available
 #ifndef IMGUI_HAS_DOCK
@@ -18,6 +46,11 @@
 #endif
 
 using namespace DachshundEngine::Sensor;
+using namespace DachshundEngine::Alert;
+using namespace DachshundEngine::Event;
+using namespace DachshundEngine::Time;
+using namespace DachshundEngine::Analytics;
+using namespace DachshundEngine::Ipc;
 
 static void glfw_error_callback(int error, const char* description)
 {
@@ -73,10 +106,168 @@ int main()
 
     // Mode management
     bool monitoring_mode = true;
+    bool analytics_window = false;
     
+    // 모듈 간 이벤트 버스 (매니저보다 먼저 생성되어 나중에 파괴되어야 함)
+    EventBus event_bus(8192);
+
+    // 공유 메모리 내보내기 (다른 로컬 프로세스가 같은 샘플 스트림을 읽음, 매니저보다 오래 살아야 함)
+    SharedRingWriter shared_ring;
+
+    // 스펙트럼 분석기 (매니저의 배치 처리기로 연결되므로 매니저보다 먼저 생성)
+    SpectralAnalyzer spectral;
+    spectral.addChannel(toChannelId(SensorChannel::TEMPERATURE));
+
+    // 이상치 탐지 (모션은 0/1 값이라 제외), 탐지 결과는 버스로 발행
+    AnomalyConfig anomaly_config;
+    anomaly_config.channels = {
+        toChannelId(SensorChannel::TEMPERATURE), toChannelId(SensorChannel::HUMIDITY),
+        toChannelId(SensorChannel::PRESSURE), toChannelId(SensorChannel::LIGHT),
+        toChannelId(SensorChannel::CPU_USAGE), toChannelId(SensorChannel::MEMORY_USAGE)
+    };
+    AnomalyDetector anomaly_detector(anomaly_config);
+    std::vector<AnomalyEvent> anomalies;
+
+    // 장기 분위수 (10초 구간 스케치, 1시간 보관)
+    QuantileStoreConfig quantile_config;
+    quantile_config.channels = { toChannelId(SensorChannel::TEMPERATURE), toChannelId(SensorChannel::CPU_USAGE) };
+    QuantileStore quantile_store(quantile_config);
+
+    // 플릿 요약 (디바이스별 EWMA 값 기준, 30초 동안 소식 없으면 제외)
+    FleetConfig fleet_config;
+    fleet_config.stale_after = 30 * kNanosPerSecond;
+    FleetAggregator fleet(fleet_config);
+
+    // 채널 간 상관 (로컬 디바이스, 최근 256 샘플)
+    CorrelationMatrix correlation({
+        { 0, toChannelId(SensorChannel::TEMPERATURE) }, { 0, toChannelId(SensorChannel::HUMIDITY) },
+        { 0, toChannelId(SensorChannel::LIGHT) }, { 0, toChannelId(SensorChannel::MOTION) },
+        { 0, toChannelId(SensorChannel::CPU_USAGE) }
+    }, 256);
+
+    // 디바이스 간 온도 상관: 디바이스마다 1초 격자로 선형 리샘플링해 시각을 맞춘 뒤 조인
+    // (먼저 보인 순서로 최대 kMaxCorrelatedDevices 개, 5초 넘게 늦는 디바이스는 기다리지 않음)
+    const size_t kMaxCorrelatedDevices = 6;
+    ResamplerConfig device_resample_config;
+    device_resample_config.method = ResampleMethod::LINEAR;
+    device_resample_config.max_gap = 10 * kNanosPerSecond;
+    JoinConfig device_join_config;
+    device_join_config.max_lateness = 5 * kNanosPerSecond;
+    device_join_config.max_buffered_frames = 600;
+    std::unordered_map<uint32_t, Resampler> device_resamplers;
+    std::vector<uint32_t> correlated_devices;
+    TimeAlignedJoin device_join(device_join_config);
+    CorrelationMatrix device_correlation({ { 0, toChannelId(SensorChannel::TEMPERATURE) } }, 120);
+    SensorBatch device_resampled;
+    AlignedBatch device_aligned;
+
+    // 값 분포 (5초 구간 x 120칸 = 최근 10분)
+    HistogramConfig histogram_config;
+    histogram_config.bucket_ns = 5 * kNanosPerSecond;
+    histogram_config.channels = {
+        { toChannelId(SensorChannel::TEMPERATURE), 15.0f, 35.0f, 40, BinScale::LINEAR },
+        { toChannelId(SensorChannel::HUMIDITY), 20.0f, 100.0f, 40, BinScale::LINEAR },
+        { toChannelId(SensorChannel::LIGHT), 0.1f, 1000.0f, 40, BinScale::LOG },
+        { toChannelId(SensorChannel::CPU_USAGE), 0.0f, 100.0f, 40, BinScale::LINEAR }
+    };
+    HistogramStore histograms(histogram_config);
+
+    // 모션 전이 로그 (샘플 대신 전이 시각만 저장)
+    EdgeLog motion_log;
+
+    // 트리거 캡처 (알림 발생, 모션 시작, 수동 버튼 시 전후 5초를 원본 속도로 보관)
+    TriggerCapture trigger_capture;
+    std::deque<Capture> captures;
+    const size_t max_captures = 8;
+
     // 센서 매니저 초기화 (기본값: 목 데이터 모드)
     SensorDataManager sensorManager(SensorMode::MOCK_DATA);
     ConnectionStatus connection;
+
+    // 온도 알림 규칙 (수집되는 모든 샘플에 대해 평가됨)
+    AlertRule high_temp_rule;
+    high_temp_rule.name = "High Temp";
+    high_temp_rule.channel = toChannelId(SensorChannel::TEMPERATURE);
+    high_temp_rule.comparison = Comparison::ABOVE;
+    high_temp_rule.threshold = 28.0f;
+    high_temp_rule.hysteresis = 0.5f;
+    high_temp_rule.debounce_samples = 3;
+    RuleId high_temp_id = sensorManager.getAlertEngine().addRule(high_temp_rule);
+
+    AlertRule low_temp_rule = high_temp_rule;
+    low_temp_rule.name = "Low Temp";
+    low_temp_rule.comparison = Comparison::BELOW;
+    low_temp_rule.threshold = 22.0f;
+    low_temp_rule.severity = AlertSeverity::INFO;
+    RuleId low_temp_id = sensorManager.getAlertEngine().addRule(low_temp_rule);
+
+    sensorManager.addBatchProcessor([&spectral](const SensorBatch& batch) { spectral.process(batch); });
+    sensorManager.addBatchProcessor([&quantile_store](const SensorBatch& batch) { quantile_store.process(batch); });
+    sensorManager.addBatchProcessor([&fleet](const SensorBatch& batch) { fleet.process(batch); });
+    sensorManager.addBatchProcessor([&histograms](const SensorBatch& batch) { histograms.process(batch); });
+    sensorManager.addBatchProcessor([&motion_log](const SensorBatch& batch) { motion_log.process(batch); });
+    sensorManager.addBatchProcessor([&trigger_capture](const SensorBatch& batch) { trigger_capture.process(batch); });
+    sensorManager.setOnAlert([&trigger_capture](const AlertEvent& alert) {
+        if (alert.transition == AlertTransition::RAISED) {
+            trigger_capture.trigger(TriggerSource::ALERT, alert.device_id, alert.timestamp_ns);
+        }
+    });
+    sensorManager.addBatchProcessor([&correlation](const SensorBatch& batch) {
+        if (batch.device_id == 0) {
+            correlation.process(batch);
+        }
+    });
+    sensorManager.addBatchProcessor([&](const SensorBatch& batch) {
+        auto resampler = device_resamplers.find(batch.device_id);
+        if (resampler == device_resamplers.end()) {
+            if (correlated_devices.size() >= kMaxCorrelatedDevices) {
+                return;
+            }
+            resampler = device_resamplers.emplace(batch.device_id, Resampler(device_resample_config)).first;
+            device_join.addStream(batch.device_id);
+            correlated_devices.push_back(batch.device_id);
+            // 스트림이 늘면 변수도 늘어나므로 창을 새로 시작
+            std::vector<CorrelationInput> inputs;
+            for (size_t stream = 0; stream < correlated_devices.size(); ++stream) {
+                inputs.push_back({ stream, toChannelId(SensorChannel::TEMPERATURE) });
+            }
+            device_correlation = CorrelationMatrix(std::move(inputs), 120);
+        }
+        device_resampled.clear();
+        resampler->second.process(batch, device_resampled);
+        device_aligned.clear();
+        device_join.push(device_resampled, device_aligned);
+        device_correlation.process(device_aligned);
+    });
+    sensorManager.addBatchProcessor([&](const SensorBatch& batch) {
+        anomalies.clear();
+        anomaly_detector.process(batch, anomalies);
+        for (const auto& anomaly : anomalies) {
+            BusEvent event;
+            event.timestamp_ns = anomaly.timestamp_ns;
+            event.payload = anomaly;
+            event_bus.publish(event);
+        }
+    });
+
+    // 기본 평활 채널 (원본 온도 옆에 temperature_ema로 저장/발행)
+    FilterSpec temperature_ema;
+    temperature_ema.source = toChannelId(SensorChannel::TEMPERATURE);
+    temperature_ema.type = FilterType::EMA;
+    ChannelId temperature_ema_channel;
+    sensorManager.getFilterBank().define(temperature_ema, temperature_ema_channel);
+
+    // 센서 매니저가 버스에 발행, UI는 자기 속도로 구독
+    sensorManager.attachEventBus(&event_bus);
+
+    // 수집은 샘플링 스레드가 수집 주기마다 수행 (모니터 주사율과 무관)
+    static int update_interval_ms = 100;
+    sensorManager.setUpdateInterval(static_cast<float>(update_interval_ms));
+    sensorManager.startSampling();
+    SubscriberId ui_subscriber = event_bus.subscribe("dashboard");
+    std::deque<std::string> event_log;
+    const size_t max_event_log = 8;
+    static int sampling_rate_ms = 1000;
     bool simulate_connection = false; // Toggle for testing
     
     // 연결 설정
@@ -86,13 +277,14 @@ int main()
     
     ImVec4 clear_color = ImVec4(0.1f, 0.1f, 0.1f, 1.00f);
 
-    // Data storage for plotting
+    // Data storage for plotting (타임스탬프는 나노초 정수로 보관하고 그릴 때만 상대 초로 변환)
     std::vector<float> temp_data, humidity_data, pressure_data, light_data;
-    std::vector<float> time_data;
+    std::vector<Timestamp> time_data;
+    std::vector<std::vector<float>> extra_data(SampleEvent::kMaxExtraChannels);   // 파생 채널 등 확장 채널
     
     // System Status data storage
     std::vector<float> cpu_data, memory_data;
-    std::vector<float> system_time_data;
+    std::vector<Timestamp> system_time_data;
     const int max_system_data_points = 60; // 60개 데이터 포인트 (60초)
     
     const int max_data_points = 100;
@@ -105,55 +297,104 @@ int main()
     SystemMetric selected_metric = SystemMetric::CPU;
     
     // 시스템 데이터 수집 타이머 (1초마다)
-    float last_system_data_time = 0.0f;
-    const float system_data_interval = 1.0f; // 1초마다 수집
+    Timestamp last_system_data_time = 0;
+    const Timestamp system_data_interval = kNanosPerSecond; // 1초마다 수집
+
+    const Timestamp session_start = sensorManager.getClock().now();
+
+    // 현재 시각 기준 상대 시간(초)으로 변환
+    auto toRelativeSeconds = [](const std::vector<Timestamp>& times, Timestamp now) {
+        std::vector<float> relative;
+        relative.reserve(times.size());
+        for (Timestamp t : times) {
+            relative.push_back(static_cast<float>(toSeconds(t - now)));
+        }
+        return relative;
+    };
 
     // Main loop
     while (!glfwWindowShouldClose(window))
     {
         glfwPollEvents();
         
-        float current_time = glfwGetTime();
+        Timestamp current_time = sensorManager.getClock().now();
         
         // 연결 상태 업데이트
         connection.updateStatus(sensorManager.isConnected(), current_time);
 
+        // 프레임을 만드는 동안 파이프라인 잠금 (분석 모듈과 필터/규칙 편집이 샘플링 스레드와 겹치지 않게)
+        auto pipeline_lock = sensorManager.lockPipeline();
+
         // 센서 데이터 가져오기
         SensorData current_data = sensorManager.getCurrentSensorData();
-        
-        // Store sensor data for plotting only when connected and data is valid
-        if (current_data.isValid()) {   // 목 데이터 확인 용 조건 주석처리 connection.is_connected && 
-            time_data.push_back(current_time);
-            temp_data.push_back(current_data.temperature);
-            humidity_data.push_back(current_data.humidity);
-            pressure_data.push_back(current_data.pressure);
-            light_data.push_back(current_data.light);
-            
-            // Keep only recent data
-            if (time_data.size() > max_data_points) {
-                time_data.erase(time_data.begin());
-                temp_data.erase(temp_data.begin());
-                humidity_data.erase(humidity_data.begin());
-                pressure_data.erase(pressure_data.begin());
-                light_data.erase(light_data.begin());
+
+        // 버스에서 샘플/알림/연결 이벤트 수집
+        event_bus.poll(ui_subscriber, [&](const BusEvent& event) {
+            if (const auto* sample = std::get_if<SampleEvent>(&event.payload)) {
+                // 그래프는 기본 디바이스만 (추가 소스의 디바이스는 Fleet 탭에서 집계)
+                if (sample->device_id != 0) {
+                    return;
+                }
+                const SensorData& data = sample->data;
+                time_data.push_back(event.timestamp_ns);
+                temp_data.push_back(data.temperature);
+                humidity_data.push_back(data.humidity);
+                pressure_data.push_back(data.pressure);
+                light_data.push_back(data.light);
+                for (size_t e = 0; e < extra_data.size(); ++e) {
+                    extra_data[e].push_back(e < sample->extra_count ? sample->extra[e] : NAN);
+                }
+                
+                // Keep only recent data
+                if (time_data.size() > max_data_points) {
+                    time_data.erase(time_data.begin());
+                    temp_data.erase(temp_data.begin());
+                    humidity_data.erase(humidity_data.begin());
+                    pressure_data.erase(pressure_data.begin());
+                    light_data.erase(light_data.begin());
+                    for (auto& values : extra_data) {
+                        values.erase(values.begin());
+                    }
+                }
+
+                // Store system status data (1초마다만 수집)
+                if (event.timestamp_ns - last_system_data_time >= system_data_interval) {
+                    system_time_data.push_back(event.timestamp_ns);
+                    cpu_data.push_back(data.cpu_usage);
+                    memory_data.push_back(data.memory_usage);
+                    
+                    // 60개 데이터 포인트만 유지
+                    if (system_time_data.size() > max_system_data_points) {
+                        system_time_data.erase(system_time_data.begin());
+                        cpu_data.erase(cpu_data.begin());
+                        memory_data.erase(memory_data.begin());
+                    }
+                    
+                    last_system_data_time = event.timestamp_ns;
+                }
+                return;
             }
-        }
-        
-        // Store system status data (1초마다만 수집)
-        if (current_data.data_valid && (current_time - last_system_data_time >= system_data_interval)) {
-            system_time_data.push_back(current_time);
-            cpu_data.push_back(current_data.cpu_usage);
-            memory_data.push_back(current_data.memory_usage);
-            
-            // 60개 데이터 포인트만 유지
-            if (system_time_data.size() > max_system_data_points) {
-                system_time_data.erase(system_time_data.begin());
-                cpu_data.erase(cpu_data.begin());
-                memory_data.erase(memory_data.begin());
+
+            char line[128];
+            double at = toSeconds(event.timestamp_ns - session_start);
+            if (const auto* alert = std::get_if<AlertEvent>(&event.payload)) {
+                AlertRule rule;
+                const char* name = sensorManager.getAlertEngine().getRule(alert->rule_id, rule) ? rule.name.c_str() : "?";
+                snprintf(line, sizeof(line), "[%.1fs] %s %s (%.1f)", at, name,
+                         alert->transition == AlertTransition::RAISED ? "raised" : "cleared", alert->value);
+            } else if (const auto* anomaly = std::get_if<AnomalyEvent>(&event.payload)) {
+                snprintf(line, sizeof(line), "[%.1fs] anomaly %s = %.2f (score %.1f)", at,
+                         sensorManager.getChannelRegistry().getName(anomaly->channel).c_str(), anomaly->value, anomaly->score);
+            } else if (const auto* conn = std::get_if<ConnectionEvent>(&event.payload)) {
+                snprintf(line, sizeof(line), "[%.1fs] connection state %d", at, static_cast<int>(conn->state));
+            } else {
+                return;
             }
-            
-            last_system_data_time = current_time;
-        }
+            event_log.push_back(line);
+            if (event_log.size() > max_event_log) {
+                event_log.pop_front();
+            }
+        });
 
         // Start the Dear ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
@@ -164,6 +405,7 @@ int main()
         if (ImGui::BeginMainMenuBar()) {
             if (ImGui::BeginMenu("Windows")) {
                 ImGui::MenuItem("Monitoring Mode", nullptr, &monitoring_mode);
+                ImGui::MenuItem("Analytics", nullptr, &analytics_window);
                 ImGui::EndMenu();
             }
             if (ImGui::BeginMenu("Debug")) {
@@ -207,6 +449,9 @@ int main()
             if (ImGui::RadioButton("Raspberry Pi", use_raspberry_pi)) {
                 use_raspberry_pi = true;
             }
+            if (ImGui::SliderInt("Update (ms)", &update_interval_ms, 10, 1000)) {
+                sensorManager.setUpdateInterval(static_cast<float>(update_interval_ms));
+            }
             
             ImGui::Separator();
             
@@ -228,7 +473,12 @@ int main()
                 } else {
                     ImGui::TextColored(ImVec4(0, 1, 0, 1), "● CONNECTED");
                     ImGui::Text("IP: %s:%d", raspberry_pi_ip, raspberry_pi_port);
-                    ImGui::Text("Last Data: %.1f sec ago", current_time - connection.last_data_time);
+                    ImGui::Text("Last Data: %.1f sec ago", toSeconds(current_time - connection.last_data_time));
+
+                    ImGui::InputInt("Sampling (ms)", &sampling_rate_ms, 100, 1000);
+                    if (ImGui::Button("Apply Sampling Rate", ImVec2(-1, 0))) {
+                        event_bus.publish(makeCommandEvent("set_sampling_rate", static_cast<float>(sampling_rate_ms)));
+                    }
                     
                     if (ImGui::Button("Disconnect", ImVec2(-1, 0))) {
                         sensorManager.disconnect();
@@ -238,6 +488,18 @@ int main()
             } else {
                 ImGui::TextColored(ImVec4(0, 1, 1, 1), "● MOCK DATA MODE");
                 ImGui::Text("Generating simulated sensor data");
+
+                // 같은 시드면 같은 신호가 다시 나옴
+                static int mock_seed = 1;
+                static float mock_rate_hz = 10.0f;
+                ImGui::InputInt("Seed", &mock_seed);
+                ImGui::SliderFloat("Rate (Hz)", &mock_rate_hz, 1.0f, 200.0f, "%.0f");
+                if (ImGui::Button("Apply Mock Settings", ImVec2(-1, 0))) {
+                    MockConfig mock_config = sensorManager.getMockGenerator().getConfig();
+                    mock_config.seed = static_cast<uint64_t>(mock_seed);
+                    mock_config.sample_rate_hz = mock_rate_hz;
+                    sensorManager.getMockGenerator().setConfig(mock_config);
+                }
             }
             
             if (connection.is_connected) {
@@ -366,11 +628,7 @@ int main()
                     ImGui::Spacing();
                     
                     // 상대적 시간 계산 (현재 시간 기준으로 과거 몇 초 전인지)
-                    std::vector<float> relative_time_data;
-                    relative_time_data.reserve(system_time_data.size());
-                    for (size_t i = 0; i < system_time_data.size(); ++i) {
-                        relative_time_data.push_back(system_time_data[i] - current_time);
-                    }
+                    std::vector<float> relative_time_data = toRelativeSeconds(system_time_data, current_time);
                     
                     if (ImPlot::BeginPlot("##cpu_detail", ImVec2(-1, window_height * 0.5f), 
                         ImPlotFlags_NoTitle | ImPlotFlags_NoLegend)) {
@@ -420,11 +678,7 @@ int main()
                     ImGui::Spacing();
                     
                     // 상대적 시간 계산 (현재 시간 기준으로 과거 몇 초 전인지)
-                    std::vector<float> relative_time_data;
-                    relative_time_data.reserve(system_time_data.size());
-                    for (size_t i = 0; i < system_time_data.size(); ++i) {
-                        relative_time_data.push_back(system_time_data[i] - current_time);
-                    }
+                    std::vector<float> relative_time_data = toRelativeSeconds(system_time_data, current_time);
                     
                     if (ImPlot::BeginPlot("##memory_detail", ImVec2(-1, window_height * 0.5f),
                         ImPlotFlags_NoTitle | ImPlotFlags_NoLegend)) {
@@ -470,11 +724,7 @@ int main()
                 
                 if (!temp_data.empty() && !time_data.empty()) {
                     // 상대적 시간 계산
-                    std::vector<float> relative_time;
-                    relative_time.reserve(time_data.size());
-                    for (size_t i = 0; i < time_data.size(); ++i) {
-                        relative_time.push_back(time_data[i] - current_time);
-                    }
+                    std::vector<float> relative_time = toRelativeSeconds(time_data, current_time);
                     
                     if (ImPlot::BeginPlot("Temp", ImVec2(-1, window_height * 0.6f))) {
                         ImPlot::SetupAxes("Time", "°C", 0, 0);
@@ -485,9 +735,9 @@ int main()
                     }
                 }
                 
-                if (current_data.temperature > 28.0f) {
+                if (sensorManager.getAlertEngine().isActive(0, high_temp_id)) {
                     ImGui::TextColored(ImVec4(1, 0, 0, 1), "⚠ High Temp!");
-                } else if (current_data.temperature < 22.0f) {
+                } else if (sensorManager.getAlertEngine().isActive(0, low_temp_id)) {
                     ImGui::TextColored(ImVec4(0, 0, 1, 1), "❄ Low Temp");
                 }
             } else {
@@ -508,11 +758,7 @@ int main()
                 
                 if (!humidity_data.empty() && !time_data.empty()) {
                     // 상대적 시간 계산
-                    std::vector<float> relative_time;
-                    relative_time.reserve(time_data.size());
-                    for (size_t i = 0; i < time_data.size(); ++i) {
-                        relative_time.push_back(time_data[i] - current_time);
-                    }
+                    std::vector<float> relative_time = toRelativeSeconds(time_data, current_time);
                     
                     if (ImPlot::BeginPlot("Environment", ImVec2(-1, window_height * 0.5f))) {
                         ImPlot::SetupAxes("Time", "%", 0, 0);
@@ -574,6 +820,9 @@ int main()
                     humidity_data.clear();
                     pressure_data.clear();
                     light_data.clear();
+                    for (auto& values : extra_data) {
+                        values.clear();
+                    }
                     system_time_data.clear();
                     cpu_data.clear();
                     memory_data.clear();
@@ -584,13 +833,824 @@ int main()
                 ImGui::Text("Rate: Waiting...");
                 ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1), "Connect to resume");
             }
+
+            ImGui::Separator();
+            ImGui::Text("Events (bus: %llu published, %llu missed by subscribers)",
+                        static_cast<unsigned long long>(event_bus.getPublishedCount()),
+                        static_cast<unsigned long long>(event_bus.getDroppedCount()));
+            static bool shared_export = false;
+            if (ImGui::Checkbox("Shared memory export", &shared_export)) {
+                if (shared_export && shared_ring.open()) {
+                    sensorManager.attachSharedRing(&shared_ring);
+                } else {
+                    sensorManager.attachSharedRing(nullptr);
+                    shared_ring.close();
+                    shared_export = false;
+                }
+            }
+            if (shared_ring.isOpen()) {
+                ImGui::SameLine();
+                ImGui::Text("%s: %llu samples", shared_ring.getConfig().name.c_str(),
+                            static_cast<unsigned long long>(shared_ring.getWrittenCount()));
+                for (const auto& reader : shared_ring.getReaders()) {
+                    ImGui::BulletText("%s (pid %d): lag %llu, missed %llu", reader.name.c_str(), reader.pid,
+                                      static_cast<unsigned long long>(reader.lag),
+                                      static_cast<unsigned long long>(reader.missed));
+                }
+            } else if (!shared_ring.getLastError().empty()) {
+                ImGui::SameLine();
+                ImGui::TextColored(ImVec4(1, 0.4f, 0.4f, 1), "%s", shared_ring.getLastError().c_str());
+            }
+            for (const auto& line : event_log) {
+                ImGui::TextUnformatted(line.c_str());
+            }
             ImGui::EndChild();
 
             ImGui::End();
         }
 
+        // Analytics 창
+        if (analytics_window) {
+            ImGui::SetNextWindowSize(ImVec2(720, 480), ImGuiCond_FirstUseEver);
+            ImGui::Begin("Analytics", &analytics_window);
+
+            if (ImGui::BeginTabBar("AnalyticsTabs")) {
+                // 파생 채널: 식으로 정의한 채널은 수집 시 계산되어 일반 채널처럼 저장/발행됨
+                if (ImGui::BeginTabItem("Derived Channels")) {
+                    static char derived_name[32] = "dew_point";
+                    static char derived_expr[128] = "dewpoint(temperature, humidity)";
+                    static std::string derived_error;
+                    DerivedChannelSet& derived = sensorManager.getDerivedChannels();
+
+                    ImGui::InputText("Name", derived_name, sizeof(derived_name));
+                    ImGui::InputText("Expression", derived_expr, sizeof(derived_expr));
+                    if (ImGui::Button("Define")) {
+                        ChannelId channel;
+                        derived_error = derived.define(derived_name, derived_expr, channel) ? "" : derived.getLastError();
+                    }
+                    if (!derived_error.empty()) {
+                        ImGui::TextColored(ImVec4(1, 0, 0, 1), "%s", derived_error.c_str());
+                    }
+                    ImGui::Separator();
+
+                    std::string to_remove;
+                    for (size_t i = 0; i < derived.size(); ++i) {
+                        size_t slot = derived.getChannel(i) - kSensorChannelCount;
+                        float latest = (slot < extra_data.size() && !extra_data[slot].empty()) ? extra_data[slot].back() : NAN;
+                        ImGui::PushID(static_cast<int>(i));
+                        if (ImGui::SmallButton("Remove")) {
+                            to_remove = derived.getName(i);
+                        }
+                        ImGui::SameLine();
+                        ImGui::Text("%s = %s  ->  %.2f", derived.getName(i).c_str(), derived.getExpression(i).c_str(), latest);
+                        ImGui::PopID();
+                    }
+                    if (!to_remove.empty() && !derived.remove(to_remove)) {
+                        derived_error = derived.getLastError();
+                    }
+
+                    if (derived.size() > 0 && !time_data.empty()) {
+                        std::vector<float> relative_time = toRelativeSeconds(time_data, current_time);
+                        if (ImPlot::BeginPlot("##derived", ImVec2(-1, -1))) {
+                            ImPlot::SetupAxes("Time", "Value", 0, ImPlotAxisFlags_AutoFit);
+                            ImPlot::SetupAxisLimits(ImAxis_X1, -60.0, 0.0, ImGuiCond_Always);
+                            ImPlot::SetupAxisFormat(ImAxis_X1, "%.0fs");
+                            for (size_t i = 0; i < derived.size(); ++i) {
+                                size_t slot = derived.getChannel(i) - kSensorChannelCount;
+                                if (slot < extra_data.size() && extra_data[slot].size() == relative_time.size()) {
+                                    ImPlot::PlotLine(derived.getName(i).c_str(), relative_time.data(),
+                                                     extra_data[slot].data(), static_cast<int>(relative_time.size()));
+                                }
+                            }
+                            ImPlot::EndPlot();
+                        }
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 보정: 디바이스/채널별 gain/offset (수정본을 통째로 교체하므로 수집은 멈추지 않음)
+                if (ImGui::BeginTabItem("Calibration")) {
+                    static int calibration_device = -1;
+                    static int calibration_channel = 0;
+                    static float calibration_gain = 1.0f;
+                    static float calibration_offset = 0.0f;
+                    static char calibration_path[128] = "calibration.csv";
+                    static std::string calibration_status;
+                    std::shared_ptr<const CalibrationTable> current = sensorManager.getCalibration();
+                    const char* channel_names[kSensorChannelCount];
+                    for (size_t i = 0; i < kSensorChannelCount; ++i) {
+                        channel_names[i] = channelName(static_cast<ChannelId>(i));
+                    }
+
+                    ImGui::InputText("File", calibration_path, sizeof(calibration_path));
+                    ImGui::SameLine();
+                    if (ImGui::Button("Load")) {
+                        auto table = std::make_shared<CalibrationTable>();
+                        if (loadCalibrationCsv(calibration_path, sensorManager.getChannelRegistry(), *table, calibration_status)) {
+                            calibration_status = "Loaded " + std::to_string(table->size()) + " entries";
+                            sensorManager.setCalibration(table);
+                        }
+                    }
+                    ImGui::InputInt("Device (-1 = all)", &calibration_device);
+                    ImGui::Combo("Channel", &calibration_channel, channel_names, static_cast<int>(kSensorChannelCount));
+                    ImGui::InputFloat("Gain", &calibration_gain, 0.01f, 0.1f, "%.4f");
+                    ImGui::InputFloat("Offset", &calibration_offset, 0.1f, 1.0f, "%.3f");
+                    if (ImGui::Button("Set")) {
+                        auto table = current ? std::make_shared<CalibrationTable>(*current) : std::make_shared<CalibrationTable>();
+                        ChannelCalibration cal;
+                        cal.gain = calibration_gain;
+                        cal.offset = calibration_offset;
+                        table->set(calibration_device < 0 ? CalibrationTable::kAllDevices : static_cast<uint32_t>(calibration_device),
+                                   static_cast<ChannelId>(calibration_channel), cal);
+                        sensorManager.setCalibration(table);
+                        calibration_status.clear();
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::Button("Clear All")) {
+                        sensorManager.setCalibration(nullptr);
+                        calibration_status.clear();
+                    }
+                    if (!calibration_status.empty()) {
+                        ImGui::TextWrapped("%s", calibration_status.c_str());
+                    }
+                    ImGui::Separator();
+
+                    if (current && ImGui::BeginTable("##calibration", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                        ImGui::TableSetupColumn("Device");
+                        ImGui::TableSetupColumn("Channel");
+                        ImGui::TableSetupColumn("Gain");
+                        ImGui::TableSetupColumn("Offset");
+                        ImGui::TableSetupColumn("LUT points");
+                        ImGui::TableHeadersRow();
+                        current->forEach([&](uint32_t device, ChannelId channel, const ChannelCalibration& cal) {
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            if (device == CalibrationTable::kAllDevices) {
+                                ImGui::TextUnformatted("*");
+                            } else {
+                                ImGui::Text("%u", device);
+                            }
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted(sensorManager.getChannelRegistry().getName(channel).c_str());
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.4f", cal.gain);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.3f", cal.offset);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%zu", cal.hasLut() ? cal.lut.size() : static_cast<size_t>(0));
+                        });
+                        ImGui::EndTable();
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 데이터 품질: 채널별 범위/고착/NaN 검사 결과 (범위 밖 값은 수집 단계에서 결측 처리)
+                if (ImGui::BeginTabItem("Quality")) {
+                    DataValidator& validator = sensorManager.getValidator();
+                    ImGui::Text("Latest sample: %s", current_data.isValid() ? "OK" : "flagged");
+                    ImGui::SameLine();
+                    if (ImGui::Button("Reset Counters")) {
+                        validator.resetCounters();
+                    }
+                    if (ImGui::BeginTable("##quality", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                        ImGui::TableSetupColumn("Channel");
+                        ImGui::TableSetupColumn("Range");
+                        ImGui::TableSetupColumn("Samples");
+                        ImGui::TableSetupColumn("NaN");
+                        ImGui::TableSetupColumn("Out of range");
+                        ImGui::TableSetupColumn("Stuck");
+                        ImGui::TableSetupColumn("Bad %");
+                        ImGui::TableHeadersRow();
+                        for (const ValidationRule& rule : validator.getRules()) {
+                            QualityCounters counters = validator.getCounters(rule.channel);
+                            const bool flagged = rule.channel < 32 && (current_data.quality & (1u << rule.channel)) != 0;
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            if (flagged) {
+                                ImGui::TextColored(ImVec4(1, 0.4f, 0.4f, 1), "%s", sensorManager.getChannelRegistry().getName(rule.channel).c_str());
+                            } else {
+                                ImGui::TextUnformatted(sensorManager.getChannelRegistry().getName(rule.channel).c_str());
+                            }
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%g .. %g", rule.min, rule.max);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%llu", static_cast<unsigned long long>(counters.samples));
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%llu", static_cast<unsigned long long>(counters.nan));
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%llu", static_cast<unsigned long long>(counters.out_of_range));
+                            ImGui::TableNextColumn();
+                            if (rule.stuck_ns > 0) {
+                                ImGui::Text("%llu", static_cast<unsigned long long>(counters.stuck));
+                            } else {
+                                ImGui::TextDisabled("-");
+                            }
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", counters.samples ? 100.0 * counters.bad / counters.samples : 0.0);
+                        }
+                        ImGui::EndTable();
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 평활 필터: 원본 채널 옆에 필터 출력 채널을 만들어 수집 시 계산
+                if (ImGui::BeginTabItem("Filters")) {
+                    static int filter_source = 0;
+                    static int filter_type = 0;
+                    static char filter_name[32] = "";
+                    static FilterSpec filter_spec;
+                    static int median_window = 5;
+                    static std::string filter_error;
+                    FilterBank& filters = sensorManager.getFilterBank();
+                    const char* channel_names[kSensorChannelCount];
+                    for (size_t i = 0; i < kSensorChannelCount; ++i) {
+                        channel_names[i] = channelName(static_cast<ChannelId>(i));
+                    }
+                    const char* type_names[] = { "EMA", "Low-pass (biquad)", "Median" };
+
+                    ImGui::Combo("Source", &filter_source, channel_names, static_cast<int>(kSensorChannelCount));
+                    ImGui::Combo("Type", &filter_type, type_names, 3);
+                    switch (static_cast<FilterType>(filter_type)) {
+                    case FilterType::EMA:
+                        ImGui::SliderFloat("Alpha", &filter_spec.alpha, 0.01f, 1.0f, "%.2f");
+                        break;
+                    case FilterType::LOWPASS:
+                        ImGui::InputFloat("Sample rate (Hz)", &filter_spec.sample_rate_hz, 1.0f, 10.0f, "%.1f");
+                        ImGui::InputFloat("Cutoff (Hz)", &filter_spec.cutoff_hz, 0.1f, 1.0f, "%.2f");
+                        break;
+                    case FilterType::MEDIAN:
+                        ImGui::SliderInt("Window", &median_window, 3, static_cast<int>(FilterBank::kMaxMedianWindow));
+                        break;
+                    }
+                    ImGui::InputText("Name (optional)", filter_name, sizeof(filter_name));
+                    if (ImGui::Button("Define")) {
+                        filter_spec.name = filter_name;
+                        filter_spec.source = static_cast<ChannelId>(filter_source);
+                        filter_spec.type = static_cast<FilterType>(filter_type);
+                        filter_spec.window = static_cast<size_t>(median_window);
+                        ChannelId channel;
+                        filter_error = filters.define(filter_spec, channel) ? "" : filters.getLastError();
+                    }
+                    if (!filter_error.empty()) {
+                        ImGui::TextColored(ImVec4(1, 0, 0, 1), "%s", filter_error.c_str());
+                    }
+                    ImGui::Separator();
+
+                    std::string to_remove;
+                    for (size_t i = 0; i < filters.size(); ++i) {
+                        const FilterSpec& spec = filters.getSpec(i);
+                        size_t slot = filters.getChannel(i) - kSensorChannelCount;
+                        float latest = (slot < extra_data.size() && !extra_data[slot].empty()) ? extra_data[slot].back() : NAN;
+                        ImGui::PushID(static_cast<int>(i));
+                        if (ImGui::SmallButton("Remove")) {
+                            to_remove = spec.name;
+                        }
+                        ImGui::SameLine();
+                        ImGui::Text("%s = %s(%s)  ->  %.2f", spec.name.c_str(), filterTypeName(spec.type),
+                                    channelName(spec.source), latest);
+                        ImGui::PopID();
+                    }
+                    if (!to_remove.empty()) {
+                        filters.remove(to_remove);
+                    }
+
+                    if (filters.size() > 0 && !time_data.empty()) {
+                        // 원본은 대시보드가 보관하는 채널만 함께 그림
+                        auto rawSeries = [&](ChannelId channel) -> const std::vector<float>* {
+                            switch (static_cast<SensorChannel>(channel)) {
+                            case SensorChannel::TEMPERATURE: return &temp_data;
+                            case SensorChannel::HUMIDITY:    return &humidity_data;
+                            case SensorChannel::PRESSURE:    return &pressure_data;
+                            case SensorChannel::LIGHT:       return &light_data;
+                            default:                         return nullptr;
+                            }
+                        };
+                        std::vector<float> relative_time = toRelativeSeconds(time_data, current_time);
+                        if (ImPlot::BeginPlot("##filters", ImVec2(-1, -1))) {
+                            ImPlot::SetupAxes("Time", "Value", 0, ImPlotAxisFlags_AutoFit);
+                            ImPlot::SetupAxisLimits(ImAxis_X1, -60.0, 0.0, ImGuiCond_Always);
+                            ImPlot::SetupAxisFormat(ImAxis_X1, "%.0fs");
+                            std::vector<ChannelId> plotted_sources;
+                            for (size_t i = 0; i < filters.size(); ++i) {
+                                const ChannelId source = filters.getSpec(i).source;
+                                const std::vector<float>* raw = rawSeries(source);
+                                if (raw && raw->size() == relative_time.size() &&
+                                    std::find(plotted_sources.begin(), plotted_sources.end(), source) == plotted_sources.end()) {
+                                    ImPlot::PlotLine(channelName(source), relative_time.data(), raw->data(),
+                                                     static_cast<int>(relative_time.size()));
+                                    plotted_sources.push_back(source);
+                                }
+                                size_t slot = filters.getChannel(i) - kSensorChannelCount;
+                                if (slot < extra_data.size() && extra_data[slot].size() == relative_time.size()) {
+                                    ImPlot::PlotLine(filters.getSpec(i).name.c_str(), relative_time.data(),
+                                                     extra_data[slot].data(), static_cast<int>(relative_time.size()));
+                                }
+                            }
+                            ImPlot::EndPlot();
+                        }
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 스펙트럼: 선택 채널의 슬라이딩 DFT (샘플마다 증분 갱신)
+                if (ImGui::BeginTabItem("Spectrum")) {
+                    static int spectral_channel = 0;
+                    static std::vector<float> magnitudes, frequencies, spectrogram;
+                    const char* channel_names[kSensorChannelCount];
+                    for (size_t i = 0; i < kSensorChannelCount; ++i) {
+                        channel_names[i] = channelName(static_cast<ChannelId>(i));
+                    }
+                    if (ImGui::Combo("Channel", &spectral_channel, channel_names, static_cast<int>(kSensorChannelCount))) {
+                        for (size_t i = 0; i < kSensorChannelCount; ++i) {
+                            spectral.removeChannel(static_cast<ChannelId>(i));
+                        }
+                        spectral.addChannel(static_cast<ChannelId>(spectral_channel));
+                    }
+                    const ChannelId channel = static_cast<ChannelId>(spectral_channel);
+
+                    double bin_hz = 0.0;
+                    if (spectral.getSpectrum(0, channel, magnitudes, bin_hz)) {
+                        // DC(평균) 빈은 다른 성분을 가리므로 제외
+                        frequencies.resize(magnitudes.size());
+                        for (size_t k = 0; k < frequencies.size(); ++k) {
+                            frequencies[k] = static_cast<float>(k * (bin_hz > 0.0 ? bin_hz : 1.0));
+                        }
+                        ImGui::Text("Resolution: %.4f Hz/bin, window %zu samples", bin_hz, spectral.getConfig().window);
+                        if (ImPlot::BeginPlot("##spectrum", ImVec2(-1, 200))) {
+                            ImPlot::SetupAxes(bin_hz > 0.0 ? "Frequency (Hz)" : "Bin", "Amplitude", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                            ImPlot::PlotLine("Amplitude", frequencies.data() + 1, magnitudes.data() + 1,
+                                             static_cast<int>(magnitudes.size() - 1));
+                            ImPlot::EndPlot();
+                        }
+                    } else {
+                        ImGui::Text("Collecting %zu samples...", spectral.getConfig().window);
+                    }
+
+                    size_t rows = 0, cols = 0;
+                    if (spectral.getSpectrogram(0, channel, spectrogram, rows, cols)) {
+                        // DC 행(맨 아래)을 빼고 그림
+                        int plot_rows = static_cast<int>(rows - 1);
+                        float scale_max = 0.0f;
+                        for (size_t i = 0; i < static_cast<size_t>(plot_rows) * cols; ++i) {
+                            scale_max = std::max(scale_max, spectrogram[i]);
+                        }
+                        ImPlot::PushColormap(ImPlotColormap_Viridis);
+                        if (ImPlot::BeginPlot("##spectrogram", ImVec2(-80, -1))) {
+                            ImPlot::SetupAxes("Time", bin_hz > 0.0 ? "Frequency (Hz)" : "Bin", ImPlotAxisFlags_NoTickLabels, 0);
+                            double resolution = bin_hz > 0.0 ? bin_hz : 1.0;
+                            ImPlot::PlotHeatmap("##spectrogram_map", spectrogram.data(), plot_rows, static_cast<int>(cols),
+                                                0.0, scale_max, nullptr, ImPlotPoint(0, 0.5 * resolution),
+                                                ImPlotPoint(static_cast<double>(cols), (rows - 0.5) * resolution));
+                            ImPlot::EndPlot();
+                        }
+                        ImGui::SameLine();
+                        ImPlot::ColormapScale("##spectrogram_scale", 0.0, scale_max, ImVec2(60, -1));
+                        ImPlot::PopColormap();
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 분위수: 구간 스케치를 병합해 긴 구간의 p50/p95/p99 계산 (원본 이력 불필요)
+                if (ImGui::BeginTabItem("Percentiles")) {
+                    static int window_index = 1;
+                    static int quantile_channel = 0;
+                    const char* window_labels[] = { "1 min", "10 min", "1 hour" };
+                    const Timestamp window_lengths[] = { 60 * kNanosPerSecond, 600 * kNanosPerSecond, 3600 * kNanosPerSecond };
+                    const double qs[] = { 0.5, 0.95, 0.99 };
+                    ImGui::Combo("Window", &window_index, window_labels, 3);
+
+                    QuantileSketch sketch;
+                    if (ImGui::BeginTable("##percentiles", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                        for (const char* header : { "Channel", "Samples", "Min", "p50", "p95", "p99", "Max" }) {
+                            ImGui::TableSetupColumn(header);
+                        }
+                        ImGui::TableHeadersRow();
+                        for (ChannelId channel : quantile_config.channels) {
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted(channelName(channel));
+                            if (!quantile_store.query(channel, current_time - window_lengths[window_index], current_time + 1, sketch)) {
+                                continue;
+                            }
+                            float values[3];
+                            sketch.quantiles(qs, values, 3);
+                            ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(sketch.count()));
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", sketch.min());
+                            for (float value : values) {
+                                ImGui::TableNextColumn(); ImGui::Text("%.2f", value);
+                            }
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", sketch.max());
+                        }
+                        ImGui::EndTable();
+                    }
+
+                    const char* channel_labels[] = { "temperature", "cpu_usage" };
+                    ImGui::Combo("Series", &quantile_channel, channel_labels, 2);
+                    static std::vector<Timestamp> bucket_starts;
+                    static std::vector<float> bucket_values;
+                    size_t buckets = quantile_store.getBucketQuantiles(quantile_config.channels[quantile_channel], qs, 3,
+                                                                       bucket_starts, bucket_values);
+                    if (buckets > 0 && ImPlot::BeginPlot("##bucket_percentiles", ImVec2(-1, -1))) {
+                        std::vector<float> relative_time = toRelativeSeconds(bucket_starts, current_time);
+                        ImPlot::SetupAxes("Time", "Value", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                        ImPlot::SetupAxisFormat(ImAxis_X1, "%.0fs");
+                        const char* labels[] = { "p50", "p95", "p99" };
+                        std::vector<float> series(buckets);
+                        for (size_t q = 0; q < 3; ++q) {
+                            for (size_t b = 0; b < buckets; ++b) {
+                                series[b] = bucket_values[b * 3 + q];
+                            }
+                            ImPlot::PlotStairs(labels[q], relative_time.data(), series.data(), static_cast<int>(buckets));
+                        }
+                        ImPlot::EndPlot();
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 플릿: 디바이스 전체 요약과 상위 K개 디바이스
+                if (ImGui::BeginTabItem("Fleet")) {
+                    static std::vector<ChannelSummary> summaries;
+                    static std::vector<DeviceRank> ranking;
+                    static int top_k = 5;
+                    fleet.expireStale(current_time);
+                    fleet.recompute(summaries, current_time);
+                    ImGui::Text("Devices: %zu", fleet.getDeviceCount());
+
+                    // 데이터 소스: 레지스트리로 만든 목/호스트 디바이스를 추가해 여러 소스를 동시에 수집
+                    static uint32_t next_device = 1;
+                    static std::string source_error;
+                    auto add_source = [&](std::unique_ptr<SensorSource> source) {
+                        source->setDeviceId(next_device++);
+                        source_error = sensorManager.addSource(std::move(source)) == SensorDataManager::kInvalidSourceId
+                            ? sensorManager.getLastSourceError() : "";
+                    };
+                    for (const char* type : { "mock", "host" }) {
+                        std::string label = std::string("Add ") + type + " device";
+                        if (ImGui::Button(label.c_str())) {
+                            if (auto source = sourceRegistry().create(type)) {
+                                add_source(std::move(source));
+                            }
+                        }
+                        ImGui::SameLine();
+                    }
+                    ImGui::NewLine();
+                    static char serial_device[64] = "/dev/ttyUSB0";
+                    static int serial_baud = 115200;
+                    static bool serial_binary = false;
+                    ImGui::InputText("Serial Port", serial_device, sizeof(serial_device));
+                    ImGui::InputInt("Baud", &serial_baud, 0, 0);
+                    ImGui::Checkbox("Binary Frames", &serial_binary);
+                    ImGui::SameLine();
+                    if (ImGui::Button("Add serial device")) {
+                        SerialSourceConfig serial_config;
+                        serial_config.device = serial_device;
+                        serial_config.baud = serial_baud;
+                        serial_config.framing.framing = serial_binary ? SerialFraming::BINARY : SerialFraming::LINE;
+                        add_source(std::make_unique<SerialSource>(serial_config));
+                    }
+                    // MQTT: <prefix>/<디바이스 ID>/<채널 이름> 토픽을 구독 (예: sensors/3/temperature)
+                    static char mqtt_host[64] = "127.0.0.1";
+                    static int mqtt_port = 1883;
+                    static char mqtt_prefix[64] = "sensors";
+                    ImGui::InputText("Broker", mqtt_host, sizeof(mqtt_host));
+                    ImGui::InputInt("Broker Port", &mqtt_port, 0, 0);
+                    ImGui::InputText("Topic Prefix", mqtt_prefix, sizeof(mqtt_prefix));
+                    ImGui::SameLine();
+                    if (ImGui::Button("Add MQTT bridge")) {
+                        MqttSourceConfig mqtt_config;
+                        mqtt_config.host = mqtt_host;
+                        mqtt_config.port = mqtt_port;
+                        const std::string prefix = mqtt_prefix;
+                        const int device_level = static_cast<int>(std::count(prefix.begin(), prefix.end(), '/')) + 1;
+                        for (size_t ch = 0; ch < kSensorChannelCount; ++ch) {
+                            const ChannelId channel = static_cast<ChannelId>(ch);
+                            mqtt_config.routes.push_back({ prefix + "/+/" + channelName(channel), channel, 0, device_level });
+                        }
+                        add_source(std::make_unique<MqttSource>(mqtt_config));
+                    }
+                    if (!source_error.empty()) {
+                        ImGui::TextColored(ImVec4(1, 0, 0, 1), "%s", source_error.c_str());
+                    }
+                    if (ImGui::BeginTable("##sources", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                        for (const char* header : { "Source", "Type", "Device", "Status", "" }) {
+                            ImGui::TableSetupColumn(header);
+                        }
+                        ImGui::TableHeadersRow();
+                        SourceId remove_id = SensorDataManager::kInvalidSourceId;
+                        for (SourceId id : sensorManager.getSourceIds()) {
+                            SensorSource* source = sensorManager.getSource(id);
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn(); ImGui::Text("%u", id);
+                            ImGui::TableNextColumn(); ImGui::TextUnformatted(source->getType());
+                            ImGui::TableNextColumn(); ImGui::Text("%u", source->getDeviceId());
+                            ImGui::TableNextColumn(); ImGui::TextUnformatted(source->getStatus().c_str());
+                            ImGui::TableNextColumn();
+                            if (id != SensorDataManager::kMockSourceId && id != SensorDataManager::kRaspberryPiSourceId) {
+                                ImGui::PushID(static_cast<int>(id));
+                                if (ImGui::SmallButton("Remove")) {
+                                    remove_id = id;
+                                }
+                                ImGui::PopID();
+                            }
+                        }
+                        ImGui::EndTable();
+                        if (remove_id != SensorDataManager::kInvalidSourceId) {
+                            sensorManager.removeSource(remove_id);
+                        }
+                    }
+
+                    if (ImGui::BeginTable("##fleet", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                        for (const char* header : { "Channel", "Devices", "Min", "Mean", "p50", "p90", "Max" }) {
+                            ImGui::TableSetupColumn(header);
+                        }
+                        ImGui::TableHeadersRow();
+                        for (const auto& summary : summaries) {
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn(); ImGui::TextUnformatted(channelName(summary.channel));
+                            ImGui::TableNextColumn(); ImGui::Text("%zu", summary.device_count);
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.min);
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.mean);
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.p50);
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.p90);
+                            ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.max);
+                        }
+                        ImGui::EndTable();
+                    }
+
+                    ImGui::SliderInt("Top K", &top_k, 1, 20);
+                    const std::pair<const char*, SensorChannel> rankings[] = {
+                        { "Hottest", SensorChannel::TEMPERATURE }, { "Busiest", SensorChannel::CPU_USAGE }
+                    };
+                    for (const auto& entry : rankings) {
+                        fleet.getTopK(toChannelId(entry.second), static_cast<size_t>(top_k), ranking);
+                        ImGui::Text("%s:", entry.first);
+                        for (const auto& rank : ranking) {
+                            ImGui::SameLine();
+                            ImGui::Text("#%u (%.1f)", rank.device_id, rank.value);
+                        }
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 상관 행렬: 최근 창에서 채널들이 함께 움직이는지 (-1 ~ 1)
+                if (ImGui::BeginTabItem("Correlation")) {
+                    static std::vector<float> matrix;
+                    const size_t n = correlation.getVariableCount();
+                    std::vector<const char*> labels, reversed;
+                    for (const auto& input : correlation.getInputs()) {
+                        labels.push_back(channelName(input.channel));
+                    }
+                    reversed.assign(labels.rbegin(), labels.rend());
+
+                    ImGui::Text("Window: %zu samples", correlation.getFrameCount());
+                    if (correlation.getCorrelation(matrix)) {
+                        ImPlot::PushColormap(ImPlotColormap_RdBu);
+                        if (ImPlot::BeginPlot("##correlation", ImVec2(-80, -1), ImPlotFlags_NoLegend | ImPlotFlags_NoMouseText)) {
+                            ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_Lock,
+                                              ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_Lock);
+                            ImPlot::SetupAxisTicks(ImAxis_X1, 0.5, n - 0.5, static_cast<int>(n), labels.data());
+                            ImPlot::SetupAxisTicks(ImAxis_Y1, 0.5, n - 0.5, static_cast<int>(n), reversed.data());
+                            ImPlot::PlotHeatmap("##correlation_map", matrix.data(), static_cast<int>(n), static_cast<int>(n),
+                                                -1.0, 1.0, "%.2f", ImPlotPoint(0, 0), ImPlotPoint(static_cast<double>(n), static_cast<double>(n)));
+                            ImPlot::EndPlot();
+                        }
+                        ImGui::SameLine();
+                        ImPlot::ColormapScale("##correlation_scale", -1.0, 1.0, ImVec2(60, -1));
+                        ImPlot::PopColormap();
+                    } else {
+                        ImGui::TextUnformatted("Collecting samples...");
+                    }
+
+                    // 디바이스 간 (조인 프레임 기준, 배치 처리기가 행렬을 교체할 수 있어 파이프라인 잠금 아래에서 읽음)
+                    ImGui::Separator();
+                    ImGui::TextUnformatted("Temperature across devices (1 s grid)");
+                    static std::vector<float> device_matrix;
+                    std::vector<std::string> device_names;
+                    size_t device_n = 0;
+                    size_t device_frames = 0;
+                    bool device_ready = false;
+                    {
+                        auto lock = sensorManager.lockPipeline();
+                        device_n = device_correlation.getVariableCount();
+                        device_frames = device_correlation.getFrameCount();
+                        device_ready = device_n > 1 && device_correlation.getCorrelation(device_matrix);
+                        for (uint32_t device : correlated_devices) {
+                            device_names.push_back("dev " + std::to_string(device));
+                        }
+                    }
+                    ImGui::Text("Devices: %zu, window: %zu frames", device_names.size(), device_frames);
+                    if (device_ready) {
+                        std::vector<const char*> device_labels, device_reversed;
+                        for (const auto& name : device_names) {
+                            device_labels.push_back(name.c_str());
+                        }
+                        device_reversed.assign(device_labels.rbegin(), device_labels.rend());
+                        ImPlot::PushColormap(ImPlotColormap_RdBu);
+                        if (ImPlot::BeginPlot("##device_correlation", ImVec2(-80, 300), ImPlotFlags_NoLegend | ImPlotFlags_NoMouseText)) {
+                            ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_Lock,
+                                              ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_Lock);
+                            ImPlot::SetupAxisTicks(ImAxis_X1, 0.5, device_n - 0.5, static_cast<int>(device_n), device_labels.data());
+                            ImPlot::SetupAxisTicks(ImAxis_Y1, 0.5, device_n - 0.5, static_cast<int>(device_n), device_reversed.data());
+                            ImPlot::PlotHeatmap("##device_correlation_map", device_matrix.data(), static_cast<int>(device_n),
+                                                static_cast<int>(device_n), -1.0, 1.0, "%.2f", ImPlotPoint(0, 0),
+                                                ImPlotPoint(static_cast<double>(device_n), static_cast<double>(device_n)));
+                            ImPlot::EndPlot();
+                        }
+                        ImGui::SameLine();
+                        ImPlot::ColormapScale("##device_correlation_scale", -1.0, 1.0, ImVec2(60, 300));
+                        ImPlot::PopColormap();
+                    } else {
+                        ImGui::TextUnformatted("Add devices on the Fleet tab to correlate them.");
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 분포: 시간 x 값 히트맵 (구간별 히스토그램, 열마다 합이 1)
+                if (ImGui::BeginTabItem("Distribution")) {
+                    static int histogram_index = 0;
+                    static std::vector<float> heatmap, edges;
+                    std::vector<const char*> names;
+                    for (const auto& spec : histograms.getConfig().channels) {
+                        names.push_back(channelName(spec.channel));
+                    }
+                    ImGui::Combo("Channel", &histogram_index, names.data(), static_cast<int>(names.size()));
+                    const HistogramSpec& spec = histograms.getConfig().channels[histogram_index];
+
+                    size_t rows = 0, cols = 0;
+                    Timestamp first_start = 0;
+                    if (histograms.getHeatmap(spec.channel, heatmap, rows, cols, first_start) &&
+                        histograms.getBinEdges(spec.channel, edges)) {
+                        ImGui::Text("Out of range: %llu", static_cast<unsigned long long>(histograms.getOutOfRangeCount(spec.channel)));
+                        // y축은 빈 번호 공간 (로그 빈도 균일 간격), 눈금에 실제 경계값 표시
+                        std::vector<double> tick_positions;
+                        std::vector<std::string> tick_text;
+                        std::vector<const char*> tick_labels;
+                        for (size_t b = 0; b <= rows; b += 8) {
+                            char label[16];
+                            snprintf(label, sizeof(label), "%.1f", edges[b]);
+                            tick_positions.push_back(static_cast<double>(b));
+                            tick_text.push_back(label);
+                        }
+                        for (const auto& text : tick_text) {
+                            tick_labels.push_back(text.c_str());
+                        }
+                        double x_min = toSeconds(first_start - current_time);
+                        double x_max = x_min + toSeconds(histogram_config.bucket_ns) * static_cast<double>(cols);
+
+                        ImPlot::PushColormap(ImPlotColormap_Hot);
+                        if (ImPlot::BeginPlot("##distribution", ImVec2(-80, -1), ImPlotFlags_NoLegend)) {
+                            ImPlot::SetupAxes("Time", channelName(spec.channel), ImPlotAxisFlags_Lock, ImPlotAxisFlags_Lock);
+                            ImPlot::SetupAxisFormat(ImAxis_X1, "%.0fs");
+                            ImPlot::SetupAxisTicks(ImAxis_Y1, tick_positions.data(), static_cast<int>(tick_positions.size()), tick_labels.data());
+                            ImPlot::PlotHeatmap("##distribution_map", heatmap.data(), static_cast<int>(rows), static_cast<int>(cols),
+                                                0.0, 1.0, nullptr, ImPlotPoint(x_min, 0), ImPlotPoint(x_max, static_cast<double>(rows)));
+                            ImPlot::EndPlot();
+                        }
+                        ImGui::SameLine();
+                        ImPlot::ColormapScale("##distribution_scale", 0.0, 1.0, ImVec2(60, -1));
+                        ImPlot::PopColormap();
+                    } else {
+                        ImGui::TextUnformatted("No samples yet");
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 모션 타임라인: 전이 로그에서 구간별 점유율/횟수와 최근 60초 상태
+                if (ImGui::BeginTabItem("Motion")) {
+                    const ChannelId motion = toChannelId(SensorChannel::MOTION);
+                    const std::pair<const char*, Timestamp> windows[] = {
+                        { "1 min", 60 * kNanosPerSecond }, { "10 min", 600 * kNanosPerSecond }, { "1 hour", 3600 * kNanosPerSecond }
+                    };
+                    if (ImGui::BeginTable("##motion_stats", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                        for (const char* header : { "Window", "Duty cycle", "Motion events", "Last change" }) {
+                            ImGui::TableSetupColumn(header);
+                        }
+                        ImGui::TableHeadersRow();
+                        for (const auto& window : windows) {
+                            EdgeStats stats;
+                            if (!motion_log.query(0, motion, current_time - window.second, current_time + 1, stats)) {
+                                continue;
+                            }
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn(); ImGui::TextUnformatted(window.first);
+                            ImGui::TableNextColumn(); ImGui::Text("%.1f%%", stats.duty_cycle * 100.0);
+                            ImGui::TableNextColumn(); ImGui::Text("%u", stats.rising_edges);
+                            ImGui::TableNextColumn();
+                            if (stats.last_change > 0) {
+                                ImGui::Text("%.1fs ago", toSeconds(current_time - stats.last_change));
+                            } else {
+                                ImGui::TextUnformatted("-");
+                            }
+                        }
+                        ImGui::EndTable();
+                    }
+                    ImGui::Text("Storage: %zu bytes", motion_log.getStorageBytes());
+
+                    // 전이 시각으로 계단 그래프 구성
+                    static std::vector<Timestamp> edges;
+                    bool initial_state = false;
+                    const Timestamp timeline_start = current_time - 60 * kNanosPerSecond;
+                    motion_log.getEdges(0, motion, timeline_start, current_time + 1, edges, initial_state);
+                    std::vector<float> xs, ys;
+                    bool state = initial_state;
+                    xs.push_back(-60.0f);
+                    ys.push_back(state ? 1.0f : 0.0f);
+                    for (Timestamp edge : edges) {
+                        state = !state;
+                        xs.push_back(static_cast<float>(toSeconds(edge - current_time)));
+                        ys.push_back(state ? 1.0f : 0.0f);
+                    }
+                    xs.push_back(0.0f);
+                    ys.push_back(state ? 1.0f : 0.0f);
+                    if (ImPlot::BeginPlot("##motion_timeline", ImVec2(-1, 150), ImPlotFlags_NoLegend)) {
+                        ImPlot::SetupAxes("Time", "Motion", 0, ImPlotAxisFlags_Lock);
+                        ImPlot::SetupAxisLimits(ImAxis_X1, -60.0, 0.0, ImGuiCond_Always);
+                        ImPlot::SetupAxisLimits(ImAxis_Y1, -0.1, 1.1, ImGuiCond_Always);
+                        ImPlot::SetupAxisFormat(ImAxis_X1, "%.0fs");
+                        ImPlot::PlotStairs("motion", xs.data(), ys.data(), static_cast<int>(xs.size()));
+                        ImPlot::EndPlot();
+                    }
+                    ImGui::EndTabItem();
+                }
+
+                // 트리거 캡처: 완료된 캡처 목록, CSV 저장, 선택한 캡처 그래프
+                if (ImGui::BeginTabItem("Capture")) {
+                    static int selected_capture = -1;
+                    static std::string capture_status;
+                    std::vector<Capture> finished;
+                    trigger_capture.takeCompleted(finished);
+                    for (auto& capture : finished) {
+                        captures.push_back(std::move(capture));
+                        if (captures.size() > max_captures) {
+                            captures.pop_front();
+                        }
+                        selected_capture = static_cast<int>(captures.size()) - 1;
+                    }
+
+                    if (ImGui::Button("Trigger Now")) {
+                        trigger_capture.trigger(TriggerSource::MANUAL, 0, current_time);
+                    }
+                    ImGui::SameLine();
+                    bool motion_trigger = trigger_capture.getMotionTrigger();
+                    if (ImGui::Checkbox("On motion", &motion_trigger)) {
+                        trigger_capture.setMotionTrigger(motion_trigger);
+                    }
+                    ImGui::SameLine();
+                    ImGui::Text("Active: %zu, ignored: %llu", trigger_capture.getActiveCount(),
+                                static_cast<unsigned long long>(trigger_capture.getIgnoredTriggerCount()));
+
+                    for (size_t i = 0; i < captures.size(); ++i) {
+                        const Capture& capture = captures[i];
+                        ImGui::PushID(static_cast<int>(i));
+                        char label[96];
+                        snprintf(label, sizeof(label), "#%llu %s [%.1fs] %zu samples%s",
+                                 static_cast<unsigned long long>(capture.id), triggerSourceName(capture.source),
+                                 toSeconds(capture.trigger_ns - session_start), capture.timestamps_ns.size(),
+                                 capture.truncated ? " (truncated)" : "");
+                        if (ImGui::Selectable(label, selected_capture == static_cast<int>(i), 0, ImVec2(300, 0))) {
+                            selected_capture = static_cast<int>(i);
+                        }
+                        ImGui::SameLine();
+                        if (ImGui::SmallButton("Save CSV")) {
+                            char path[64];
+                            snprintf(path, sizeof(path), "capture_%llu.csv", static_cast<unsigned long long>(capture.id));
+                            capture_status = writeCaptureCsv(capture, path, &sensorManager.getChannelRegistry())
+                                ? std::string("Saved ") + path : std::string("Failed to write ") + path;
+                        }
+                        ImGui::PopID();
+                    }
+                    if (!capture_status.empty()) {
+                        ImGui::TextUnformatted(capture_status.c_str());
+                    }
+
+                    if (selected_capture >= 0 && selected_capture < static_cast<int>(captures.size())) {
+                        const Capture& capture = captures[selected_capture];
+                        std::vector<float> relative_time(capture.timestamps_ns.size());
+                        for (size_t i = 0; i < relative_time.size(); ++i) {
+                            relative_time[i] = static_cast<float>(toSeconds(capture.timestamps_ns[i] - capture.trigger_ns));
+                        }
+                        if (ImPlot::BeginPlot("##capture", ImVec2(-1, -1))) {
+                            ImPlot::SetupAxes("Time from trigger", "Value", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                            ImPlot::SetupAxisFormat(ImAxis_X1, "%.1fs");
+                            for (size_t ch = 0; ch < capture.columns.size() && ch < kSensorChannelCount; ++ch) {
+                                ImPlot::PlotLine(channelName(static_cast<ChannelId>(ch)), relative_time.data(),
+                                                 capture.columns[ch].data(), static_cast<int>(relative_time.size()));
+                            }
+                            double trigger_line = 0.0;
+                            ImPlot::PlotInfLines("trigger", &trigger_line, 1);
+                            ImPlot::EndPlot();
+                        }
+                    }
+                    ImGui::EndTabItem();
+                }
+                ImGui::EndTabBar();
+            }
+            ImGui::End();
+        }
+
         // Rendering
         ImGui::Render();
+        pipeline_lock.unlock();
         int display_w, display_h;
         glfwGetFramebufferSize(window, &display_w, &display_h);
         glViewport(0, 0, display_w, display_h);
@@ -602,6 +1662,7 @@ int main()
     }
 
     // Cleanup
+    sensorManager.stopSampling();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImPlot::DestroyContext();
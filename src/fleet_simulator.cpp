@@ -0,0 +1,500 @@
+// 가상 플릿 시뮬레이터: localhost에 sensor_server.py와 같은 프로토콜을 쓰는 가상 Pi 엔드포인트 N개를 띄운다.
+// 디바이스 i는 base_port + i 에서 대기하며, 4바이트 빅엔디언 길이 + JSON 메시지로 센서 데이터를 보내고
+// get_sensor_data / set_sampling_rate 명령에 응답한다. 디바이스마다 주기, 신호 프로필, 지터,
+// 끊김 일정이 다르고, 소수의 이벤트 루프 스레드(poll)가 전부를 구동한다.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "core/sensor/SensorManager.h"
+#include "core/sensor/SensorBatch.h"
+#include "core/sensor/MockGenerator.h"
+#include "core/network/NetworkClient.h"
+#include "core/time/Clock.h"
+
+using namespace DachshundEngine::Sensor;
+using namespace DachshundEngine::Network;
+using namespace DachshundEngine::Time;
+
+namespace {
+
+    /// @brief 명령줄 옵션
+    struct SimulatorOptions {
+        size_t devices = 100;
+        int base_port = 9000;
+        size_t threads = 4;
+        int rate_ms = 1000;             // 기본 전송 주기
+        int rate_spread_pct = 50;       // 디바이스별 주기 편차 (±%)
+        int jitter_ms = 20;             // 전송 시각 지터 (±ms)
+        double uptime_s = 0.0;          // 평균 연결 유지 시간 (0이면 끊지 않음)
+        double downtime_s = 5.0;        // 끊긴 뒤 다시 받기까지 평균 시간
+        double duration_s = 0.0;        // 실행 시간 (0이면 Ctrl+C까지)
+        uint64_t seed = 1;
+        size_t max_pending_bytes = 64 * 1024;   // 느린 클라이언트 송신 버퍼 한도 (넘으면 샘플 버림)
+    };
+
+    /// @brief 스레드별 통계 (메인 스레드가 주기적으로 읽음)
+    struct LoopStats {
+        std::atomic<uint64_t> samples{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> accepts{0};
+        std::atomic<uint64_t> commands{0};
+        std::atomic<uint64_t> connected{0};
+        std::atomic<uint64_t> offline{0};
+    };
+
+    /// @brief 가상 Pi 한 대
+    struct VirtualDevice {
+        uint32_t id = 0;
+        int port = 0;
+        int listen_fd = -1;
+        int client_fd = -1;
+
+        std::unique_ptr<MockGenerator> generator;
+        SensorBatch batch;
+        Timestamp rate_ns = 0;
+        Timestamp nominal_send = 0;     // 지터 없는 다음 전송 시각 (누적 오차 방지)
+        Timestamp next_send = 0;
+        bool online = true;
+        Timestamp next_toggle = 0;
+
+        std::string inbox;
+        std::string outbox;
+    };
+
+    std::atomic<bool> running{true};
+
+    void onSignal(int) {
+        running = false;
+    }
+
+    bool setNonBlocking(int fd) {
+        int flags = fcntl(fd, F_GETFL, 0);
+        return flags != -1 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+    }
+
+    void closeFd(int& fd) {
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    uint64_t unixMillis() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    /// @brief 디바이스 신호 프로필 (실내 / 서버실 / 실외 순환)
+    MockConfig makeProfile(uint32_t device_id, uint64_t seed, float rate_hz) {
+        MockConfig config;
+        config.seed = seed;
+        config.sample_rate_hz = rate_hz;
+        auto& signals = config.signals;
+        switch (device_id % 3) {
+        case 1:     // 서버실: 덥고 부하가 높으며 조명 일정
+            signals[toChannelId(SensorChannel::TEMPERATURE)].base = 31.0f;
+            signals[toChannelId(SensorChannel::TEMPERATURE)].amplitude = 1.0f;
+            signals[toChannelId(SensorChannel::HUMIDITY)].base = 35.0f;
+            signals[toChannelId(SensorChannel::LIGHT)].rate_hz = 0.0f;
+            signals[toChannelId(SensorChannel::MOTION)].rate_hz = 1.0f / 300.0f;
+            signals[toChannelId(SensorChannel::CPU_USAGE)].base = 75.0f;
+            signals[toChannelId(SensorChannel::CPU_USAGE)].noise = 6.0f;
+            break;
+        case 2:     // 실외: 온습도 변화와 조도 폭이 큼
+            signals[toChannelId(SensorChannel::TEMPERATURE)].base = 15.0f;
+            signals[toChannelId(SensorChannel::TEMPERATURE)].amplitude = 8.0f;
+            signals[toChannelId(SensorChannel::HUMIDITY)].amplitude = 2.0f;
+            signals[toChannelId(SensorChannel::LIGHT)].base = 20000.0f;
+            signals[toChannelId(SensorChannel::LIGHT)].amplitude = 19000.0f;
+            signals[toChannelId(SensorChannel::LIGHT)].noise = 200.0f;
+            break;
+        default:
+            break;
+        }
+        return config;
+    }
+
+    bool openListener(VirtualDevice& device) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            return false;
+        }
+        int yes = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(device.port));
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(fd, 4) != 0 || !setNonBlocking(fd)) {
+            close(fd);
+            return false;
+        }
+        device.listen_fd = fd;
+        return true;
+    }
+
+    /// @brief 길이 접두 프레임 하나를 송신 버퍼에 추가
+    bool queueFrame(VirtualDevice& device, const std::string& payload, const SimulatorOptions& options) {
+        if (device.outbox.size() + payload.size() + 4 > options.max_pending_bytes) {
+            return false;
+        }
+        uint32_t length = htonl(static_cast<uint32_t>(payload.size()));
+        device.outbox.append(reinterpret_cast<const char*>(&length), 4);
+        device.outbox.append(payload);
+        return true;
+    }
+
+    void queueSample(VirtualDevice& device, Timestamp now, const SimulatorOptions& options, LoopStats& stats) {
+        device.batch.clear();
+        device.generator->generate(device.batch, device.id, now, 1);
+        if (queueFrame(device, JsonUtil::sensorDataToJson(device.batch.sampleAt(0), unixMillis()), options)) {
+            stats.samples.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            stats.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void dropClient(VirtualDevice& device, LoopStats& stats) {
+        if (device.client_fd >= 0) {
+            closeFd(device.client_fd);
+            stats.connected.fetch_sub(1, std::memory_order_relaxed);
+        }
+        device.inbox.clear();
+        device.outbox.clear();
+    }
+
+    /// @brief 수신 버퍼의 완성된 명령 처리 (sensor_server.py의 process_command와 같은 동작)
+    void handleCommands(VirtualDevice& device, Timestamp now, const SimulatorOptions& options, LoopStats& stats) {
+        while (device.inbox.size() >= 4) {
+            uint32_t length;
+            std::memcpy(&length, device.inbox.data(), 4);
+            length = ntohl(length);
+            if (device.inbox.size() < 4 + static_cast<size_t>(length)) {
+                return;
+            }
+            std::string message = device.inbox.substr(4, length);
+            device.inbox.erase(0, 4 + static_cast<size_t>(length));
+            stats.commands.fetch_add(1, std::memory_order_relaxed);
+
+            if (message.find("\"get_sensor_data\"") != std::string::npos) {
+                queueSample(device, now, options, stats);
+            } else if (message.find("\"set_sampling_rate\"") != std::string::npos) {
+                int rate_ms = 1000;
+                size_t pos = message.find("\"rate_ms\":");
+                if (pos != std::string::npos) {
+                    rate_ms = std::atoi(message.c_str() + pos + 10);
+                }
+                rate_ms = std::clamp(rate_ms, 100, 10000);
+                device.rate_ns = static_cast<Timestamp>(rate_ms) * kNanosPerMilli;
+                device.nominal_send = now + device.rate_ns;
+                device.next_send = device.nominal_send;
+                // 생성기 주기도 맞춰야 이벤트 비율과 신호 주기가 새 전송 주기 기준이 됨
+                MockConfig config = device.generator->getConfig();
+                config.sample_rate_hz = 1000.0f / static_cast<float>(rate_ms);
+                device.generator->setConfig(config);
+                queueFrame(device, "{\"type\":\"response\",\"cmd\":\"set_sampling_rate\",\"success\":true,"
+                                   "\"message\":\"Sampling rate set to " + std::to_string(rate_ms) + "ms\"}", options);
+            }
+        }
+    }
+
+    void flushOutbox(VirtualDevice& device, LoopStats& stats) {
+        while (!device.outbox.empty()) {
+            ssize_t sent = send(device.client_fd, device.outbox.data(), device.outbox.size(), MSG_NOSIGNAL);
+            if (sent > 0) {
+                device.outbox.erase(0, static_cast<size_t>(sent));
+                stats.bytes.fetch_add(static_cast<uint64_t>(sent), std::memory_order_relaxed);
+            } else {
+                if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    return;
+                }
+                dropClient(device, stats);
+                return;
+            }
+        }
+    }
+
+    /// @brief 이벤트 루프 스레드: 맡은 디바이스 전부의 타이머와 소켓을 poll 하나로 처리
+    void runLoop(std::vector<VirtualDevice>& devices, const SimulatorOptions& options, LoopStats& stats, uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<Timestamp> jitter(-options.jitter_ms * kNanosPerMilli,
+                                                        options.jitter_ms * kNanosPerMilli);
+        auto lifetime = [&](double mean_s) {
+            std::exponential_distribution<double> dist(1.0 / std::max(mean_s, 0.001));
+            return static_cast<Timestamp>(dist(rng) * kNanosPerSecond);
+        };
+
+        const Timestamp start = defaultClock().now();
+        for (auto& device : devices) {
+            device.next_toggle = options.uptime_s > 0.0 ? start + lifetime(options.uptime_s) : 0;
+        }
+
+        std::vector<pollfd> fds;
+        std::vector<std::pair<VirtualDevice*, bool>> owners;   // (디바이스, 대기 소켓 여부)
+        while (running.load(std::memory_order_relaxed)) {
+            const Timestamp now = defaultClock().now();
+            Timestamp deadline = now + 100 * kNanosPerMilli;
+
+            for (auto& device : devices) {
+                // 끊김 일정: 온라인이면 대기 소켓과 연결을 닫고, 오프라인이면 다시 연다
+                if (device.next_toggle != 0 && now >= device.next_toggle) {
+                    if (device.online) {
+                        dropClient(device, stats);
+                        closeFd(device.listen_fd);
+                        device.online = false;
+                        stats.offline.fetch_add(1, std::memory_order_relaxed);
+                        device.next_toggle = now + lifetime(options.downtime_s);
+                    } else if (openListener(device)) {
+                        device.online = true;
+                        stats.offline.fetch_sub(1, std::memory_order_relaxed);
+                        device.next_toggle = now + lifetime(options.uptime_s);
+                    } else {
+                        device.next_toggle = now + kNanosPerSecond;
+                    }
+                }
+                if (device.next_toggle != 0) {
+                    deadline = std::min(deadline, device.next_toggle);
+                }
+
+                if (device.client_fd >= 0 && now >= device.next_send) {
+                    queueSample(device, now, options, stats);
+                    device.nominal_send += device.rate_ns;
+                    if (device.nominal_send < now - device.rate_ns) {
+                        device.nominal_send = now + device.rate_ns;    // 크게 밀렸으면 따라잡지 않음
+                    }
+                    device.next_send = device.nominal_send + jitter(rng);
+                }
+                if (device.client_fd >= 0) {
+                    deadline = std::min(deadline, device.next_send);
+                }
+            }
+
+            fds.clear();
+            owners.clear();
+            for (auto& device : devices) {
+                if (device.listen_fd >= 0) {
+                    fds.push_back({device.listen_fd, POLLIN, 0});
+                    owners.emplace_back(&device, true);
+                }
+                if (device.client_fd >= 0) {
+                    short events = POLLIN;
+                    if (!device.outbox.empty()) {
+                        events |= POLLOUT;
+                    }
+                    fds.push_back({device.client_fd, events, 0});
+                    owners.emplace_back(&device, false);
+                }
+            }
+            int timeout_ms = static_cast<int>(std::max<Timestamp>(deadline - now, 0) / kNanosPerMilli);
+            int ready = poll(fds.data(), static_cast<nfds_t>(fds.size()), timeout_ms);
+            if (ready <= 0) {
+                continue;
+            }
+
+            const Timestamp polled = defaultClock().now();
+            for (size_t i = 0; i < fds.size(); ++i) {
+                if (fds[i].revents == 0) {
+                    continue;
+                }
+                VirtualDevice& device = *owners[i].first;
+                if (owners[i].second) {
+                    // sensor_server.py처럼 한 번에 클라이언트 하나만 받음
+                    int client = accept(device.listen_fd, nullptr, nullptr);
+                    if (client < 0) {
+                        continue;
+                    }
+                    if (device.client_fd >= 0 || !setNonBlocking(client)) {
+                        close(client);
+                        continue;
+                    }
+                    int yes = 1;
+                    setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+                    device.client_fd = client;
+                    device.nominal_send = polled;
+                    device.next_send = polled;
+                    stats.accepts.fetch_add(1, std::memory_order_relaxed);
+                    stats.connected.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                if (device.client_fd != fds[i].fd) {
+                    continue;   // 이번 루프에서 이미 닫힘
+                }
+                if (fds[i].revents & POLLIN) {
+                    char buffer[4096];
+                    ssize_t received = recv(device.client_fd, buffer, sizeof(buffer), 0);
+                    if (received > 0) {
+                        device.inbox.append(buffer, static_cast<size_t>(received));
+                        handleCommands(device, polled, options, stats);
+                    } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                        dropClient(device, stats);
+                        continue;
+                    }
+                }
+                if (fds[i].revents & (POLLERR | POLLHUP)) {
+                    dropClient(device, stats);
+                    continue;
+                }
+                if (!device.outbox.empty()) {
+                    flushOutbox(device, stats);
+                }
+            }
+        }
+
+        for (auto& device : devices) {
+            dropClient(device, stats);
+            closeFd(device.listen_fd);
+        }
+    }
+
+    void printUsage(const char* program) {
+        std::printf("usage: %s [options]\n"
+                    "  --devices N          virtual devices (default 100)\n"
+                    "  --base-port P        device i listens on 127.0.0.1:P+i (default 9000)\n"
+                    "  --threads T          event-loop threads (default 4)\n"
+                    "  --rate-ms R          base send interval (default 1000)\n"
+                    "  --rate-spread PCT    per-device interval spread, +/- percent (default 50)\n"
+                    "  --jitter-ms J        send-time jitter, +/- ms (default 20)\n"
+                    "  --uptime S           mean seconds between disconnects, 0 = never (default 0)\n"
+                    "  --downtime S         mean seconds offline after a disconnect (default 5)\n"
+                    "  --duration S         stop after S seconds, 0 = until Ctrl+C (default 0)\n"
+                    "  --seed N             signal/schedule seed (default 1)\n", program);
+    }
+
+    bool parseOptions(int argc, char** argv, SimulatorOptions& options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h" || i + 1 >= argc) {
+                return false;
+            }
+            const char* value = argv[++i];
+            if (arg == "--devices") options.devices = std::strtoul(value, nullptr, 10);
+            else if (arg == "--base-port") options.base_port = std::atoi(value);
+            else if (arg == "--threads") options.threads = std::strtoul(value, nullptr, 10);
+            else if (arg == "--rate-ms") options.rate_ms = std::atoi(value);
+            else if (arg == "--rate-spread") options.rate_spread_pct = std::atoi(value);
+            else if (arg == "--jitter-ms") options.jitter_ms = std::atoi(value);
+            else if (arg == "--uptime") options.uptime_s = std::atof(value);
+            else if (arg == "--downtime") options.downtime_s = std::atof(value);
+            else if (arg == "--duration") options.duration_s = std::atof(value);
+            else if (arg == "--seed") options.seed = std::strtoull(value, nullptr, 10);
+            else return false;
+        }
+        options.threads = std::clamp<size_t>(options.threads, 1, std::max<size_t>(options.devices, 1));
+        options.rate_ms = std::max(options.rate_ms, 1);
+        options.rate_spread_pct = std::clamp(options.rate_spread_pct, 0, 90);
+        options.jitter_ms = std::max(options.jitter_ms, 0);
+        return options.devices > 0 && options.base_port > 0 &&
+               options.base_port + static_cast<long>(options.devices) <= 65536;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    SimulatorOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    // 디바이스당 대기 소켓 + 연결 하나 (기본 한도 1024로는 500대를 넘기 어려움)
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    // 디바이스를 스레드별로 나눠 생성 (각 디바이스는 한 스레드만 건드림)
+    std::mt19937_64 rng(options.seed);
+    std::uniform_int_distribution<int> spread(-options.rate_spread_pct, options.rate_spread_pct);
+    std::vector<std::vector<VirtualDevice>> shards(options.threads);
+    size_t opened = 0;
+    for (size_t i = 0; i < options.devices; ++i) {
+        VirtualDevice device;
+        device.id = static_cast<uint32_t>(i);
+        device.port = options.base_port + static_cast<int>(i);
+        const int rate_ms = std::max(1, options.rate_ms * (100 + spread(rng)) / 100);
+        device.rate_ns = static_cast<Timestamp>(rate_ms) * kNanosPerMilli;
+        device.generator = std::make_unique<MockGenerator>(makeProfile(device.id, options.seed, 1000.0f / rate_ms));
+        if (!openListener(device)) {
+            std::fprintf(stderr, "cannot listen on 127.0.0.1:%d (%s)\n", device.port, std::strerror(errno));
+            continue;
+        }
+        opened++;
+        shards[i % options.threads].push_back(std::move(device));
+    }
+    if (opened == 0) {
+        return 1;
+    }
+    std::printf("%zu virtual devices on 127.0.0.1:%d-%d, %zu threads\n", opened, options.base_port,
+                options.base_port + static_cast<int>(options.devices) - 1, options.threads);
+
+    std::vector<LoopStats> stats(options.threads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < options.threads; ++t) {
+        threads.emplace_back(runLoop, std::ref(shards[t]), std::cref(options), std::ref(stats[t]), options.seed + t + 1);
+    }
+
+    // 주기적 통계 출력
+    const Timestamp start = defaultClock().now();
+    Timestamp last_report = start;
+    uint64_t last_samples = 0, last_bytes = 0;
+    while (running.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        const Timestamp now = defaultClock().now();
+        if (options.duration_s > 0.0 && toSeconds(now - start) >= options.duration_s) {
+            running = false;
+        }
+        if (now - last_report < 5 * kNanosPerSecond && running.load()) {
+            continue;
+        }
+        uint64_t samples = 0, bytes = 0, dropped = 0, accepts = 0, commands = 0, connected = 0, offline = 0;
+        for (const auto& s : stats) {
+            samples += s.samples.load();
+            bytes += s.bytes.load();
+            dropped += s.dropped.load();
+            accepts += s.accepts.load();
+            commands += s.commands.load();
+            connected += s.connected.load();
+            offline += s.offline.load();
+        }
+        const double elapsed = toSeconds(now - last_report);
+        std::printf("[%6.1fs] connected %llu, offline %llu | %.0f samples/s, %.1f KB/s | total %llu samples, "
+                    "%llu dropped, %llu accepts, %llu commands\n",
+                    toSeconds(now - start), static_cast<unsigned long long>(connected),
+                    static_cast<unsigned long long>(offline), (samples - last_samples) / elapsed,
+                    (bytes - last_bytes) / elapsed / 1024.0, static_cast<unsigned long long>(samples),
+                    static_cast<unsigned long long>(dropped), static_cast<unsigned long long>(accepts),
+                    static_cast<unsigned long long>(commands));
+        std::fflush(stdout);
+        last_report = now;
+        last_samples = samples;
+        last_bytes = bytes;
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return 0;
+}